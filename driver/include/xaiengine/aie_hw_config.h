@@ -0,0 +1,11 @@
+/******************************************************************************
+* Copyright (C) 2019 - 2020 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#define XAIE_FEATURE_LITE
+
+#define XAIE_DEV_SINGLE_GEN XAIE_DEV_GEN_AIE
+
+#include "xaiengine/xaie_lite_hwcfg.h"
+#include "xaiengine.h"
@@ -0,0 +1,72 @@
+/******************************************************************************
+* Copyright (C) 2019 - 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_aie.h
+* @{
+*
+* This file contains routines for AIE DMA configuration and controls. This
+* header file is not exposed to the user.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   03/23/2020  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_DMA_AIE_H
+#define XAIE_DMA_AIE_H
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/************************** Function Prototypes  *****************************/
+void _XAie_TileDmaInit(XAie_DmaDesc *Desc);
+void _XAie_ShimDmaInit(XAie_DmaDesc *Desc);
+AieRC _XAie_DmaSetLock(XAie_DmaDesc *DmaDesc, XAie_Lock Acq, XAie_Lock Rel,
+		u8 AcqEn, u8 RelEn);
+AieRC _XAie_ShimDmaCompileBd(XAie_DmaDesc *DmaDesc, u32 *BdWord,
+		u8 *NumBdWords);
+AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum);
+AieRC _XAie_ShimDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum);
+AieRC _XAie_TileDmaCompileBd(XAie_DmaDesc *DmaDesc, u32 *BdWord,
+		u8 *NumBdWords);
+AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum);
+AieRC _XAie_TileDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum);
+AieRC _XAie_DmaSetInterleaveEnable(XAie_DmaDesc *DmaDesc, u8 DoubleBuff,
+		u8 IntrleaveCount, u16 IntrleaveCurr);
+AieRC _XAie_DmaSetMultiDim(XAie_DmaDesc *DmaDesc, XAie_DmaTensor *Tensor);
+AieRC _XAie_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u8 *PendingBd);
+void _XAie_DmaGetDoneCond(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u64 *RegAddr, u32 *Mask, u32 *Value, u32 *ErrMask);
+AieRC _XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u32 TimeOutUs);
+AieRC _XAie_DmaCheckBdChValidity(u8 BdNum, u8 ChNum);
+AieRC _XAie_DmaUpdateBdLen(XAie_DevInst *DevInst, const XAie_DmaMod *DmaMod,
+		XAie_LocType Loc, u32 Len, u8 BdNum);
+AieRC _XAie_ShimDmaUpdateBdLen(XAie_DevInst *DevInst, const XAie_DmaMod *DmaMod,
+		XAie_LocType Loc, u32 Len, u8 BdNum);
+AieRC _XAie_DmaUpdateBdAddr(XAie_DevInst *DevInst, const XAie_DmaMod *DmaMod,
+		XAie_LocType Loc, u64 Addr, u8 BdNum);
+AieRC _XAie_ShimDmaUpdateBdAddr(XAie_DevInst *DevInst,
+		const XAie_DmaMod *DmaMod, XAie_LocType Loc, u64 Addr,
+		u8 BdNum);
+AieRC _XAie_DmaSetBdIteration(XAie_DmaDesc *DmaDesc, u32 StepSize, u8 Wrap,
+		u8 IterCurr);
+
+#endif /* XAIE_DMA_AIE_H */
+/** @} */
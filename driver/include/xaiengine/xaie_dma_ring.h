@@ -0,0 +1,54 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_ring.h
+* @{
+*
+* Header file for the buffer descriptor rings of AIE DMA channels.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_DMA_RING_H
+#define XAIE_DMA_RING_H
+
+/***************************** Include Files *********************************/
+#include "xaie_dma.h"
+
+/****************************** Type Definitions *****************************/
+/* Handle of a task submitted with XAie_DmaTaskSubmit() */
+typedef struct {
+	XAie_DmaBdRing *Ring;
+	u64 Seq;	/* Sequence number of the task in the ring */
+} XAie_DmaTask;
+
+/************************** Function Prototypes  *****************************/
+XAie_DmaBdRing* XAie_DmaBdRingCreate(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir, u8 NumBds);
+AieRC XAie_DmaBdRingDestroy(XAie_DmaBdRing *Ring);
+AieRC XAie_DmaBdRingSubmit(XAie_DmaBdRing *Ring, XAie_DmaDesc *Descs,
+		u8 Count, u8 Cyclic, u8 *FirstBd);
+AieRC XAie_DmaBdRingGetNumFree(XAie_DmaBdRing *Ring, u8 *NumFree);
+AieRC XAie_DmaBdRingGetBds(XAie_DmaBdRing *Ring, u8 *Bds, u8 *NumBds);
+AieRC XAie_DmaTaskSubmit(XAie_DmaBdRing *Ring, XAie_DmaDesc *Descs,
+		u8 Count, XAie_DmaTask *Task);
+AieRC XAie_DmaTaskPoll(XAie_DmaTask *Task, u8 *Done);
+AieRC XAie_DmaTaskWaitAny(XAie_DmaTask *Tasks, u32 NumTasks, u32 TimeOutUs,
+		u32 *Index);
+AieRC XAie_DmaTaskWaitAll(XAie_DmaTask *Tasks, u32 NumTasks, u32 TimeOutUs);
+void _XAie_DmaBdRingFreeAll(XAie_DevInst *DevInst);
+
+#endif		/* end of protection macro */
+
+/** @} */
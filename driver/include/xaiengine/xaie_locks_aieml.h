@@ -0,0 +1,42 @@
+/******************************************************************************
+* Copyright (C) 2019 - 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_locks_aieml.h
+* @{
+*
+* This file contains function prototypes for AIEML locks. This header file is
+* not exposed to the user.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Tejus   03/17/2020  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIELOCKS_AIEML_H
+#define XAIELOCKS_AIEML_H
+/***************************** Include Files *********************************/
+#include "xaie_locks.h"
+#include "xaiegbl_defs.h"
+#include "xaie_helper.h"
+
+/************************** Constant Definitions *****************************/
+
+/************************** Function Prototypes  *****************************/
+AieRC _XAieMl_LockAcquire(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
+		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut);
+AieRC _XAieMl_LockRelease(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
+		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut);
+AieRC _XAieMl_LockSetValue(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
+		XAie_LocType Loc, XAie_Lock Lock);
+
+#endif
+/** @} */
@@ -0,0 +1,106 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_sync.h
+* @{
+*
+* Header file for the thread synchronization of the device instance.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_SYNC_H
+#define XAIE_SYNC_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_SYNC_NONE		0xFFFFFFFFU	/* No lock was taken */
+#define XAIE_SYNC_DEVICE	0xFFFFFFFEU	/* Device lock taken exclusively */
+
+/************************** Function Prototypes  *****************************/
+AieRC _XAie_SyncEnable(XAie_DevInst *DevInst);
+void _XAie_SyncFree(XAie_DevInst *DevInst);
+u32 _XAie_SyncLockRange(XAie_DevInst *DevInst, u64 RegOff, u32 Bytes);
+u32 _XAie_SyncLockDevice(XAie_DevInst *DevInst);
+void _XAie_SyncUnlock(XAie_DevInst *DevInst, u32 Token);
+void _XAie_SyncLockTxnList(XAie_DevInst *DevInst);
+void _XAie_SyncUnlockTxnList(XAie_DevInst *DevInst);
+
+/*****************************************************************************/
+/**
+* This API takes the lock covering the registers from RegOff to RegOff + Bytes.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative offset of the first register
+* @param	Bytes: Number of bytes accessed
+*
+* @return	Token to be passed to _XAie_SyncRelease.
+*
+* @note		Internal only. No lock is taken if thread safety is disabled.
+*
+******************************************************************************/
+static inline u32 _XAie_SyncAcquire(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Bytes)
+{
+	if(DevInst->Sync == NULL) {
+		return XAIE_SYNC_NONE;
+	}
+
+	return _XAie_SyncLockRange(DevInst, RegOff, Bytes);
+}
+
+/*****************************************************************************/
+/**
+* This API takes the device lock exclusively.
+*
+* @param	DevInst: Device instance pointer
+*
+* @return	Token to be passed to _XAie_SyncRelease.
+*
+* @note		Internal only. No lock is taken if thread safety is disabled.
+*
+******************************************************************************/
+static inline u32 _XAie_SyncAcquireDevice(XAie_DevInst *DevInst)
+{
+	if(DevInst->Sync == NULL) {
+		return XAIE_SYNC_NONE;
+	}
+
+	return _XAie_SyncLockDevice(DevInst);
+}
+
+/*****************************************************************************/
+/**
+* This API releases a lock taken by _XAie_SyncAcquire or
+* _XAie_SyncAcquireDevice.
+*
+* @param	DevInst: Device instance pointer
+* @param	Token: Token returned when the lock was taken
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline void _XAie_SyncRelease(XAie_DevInst *DevInst, u32 Token)
+{
+	if(Token != XAIE_SYNC_NONE) {
+		_XAie_SyncUnlock(DevInst, Token);
+	}
+}
+
+#endif	/* end of protection macro */
+/** @} */
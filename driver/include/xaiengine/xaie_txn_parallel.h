@@ -0,0 +1,34 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txn_parallel.h
+* @{
+*
+* Header file for the column parallel execution of transactions.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_TXN_PARALLEL_H
+#define XAIE_TXN_PARALLEL_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/************************** Function Prototypes  *****************************/
+AieRC _XAie_TxnExecuteParallel(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
+void _XAie_TxnPoolFree(XAie_DevInst *DevInst);
+
+#endif	/* end of protection macro */
+/** @} */
@@ -31,24 +31,53 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#ifdef __linux__
+#define _POSIX_C_SOURCE 200112L
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#elif defined(__AIEBAREMETAL__)
+#include "sleep.h"
+#endif
+
 #include <limits.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "xaie_helper.h"
+#include "xaie_shadow.h"
+#include "xaie_sync.h"
+#include "xaie_txn_parallel.h"
 
 /************************** Constant Definitions *****************************/
 #define XAIE_DEFAULT_NUM_CMDS 1024U
-#define XAIE_DEFAULT_TXN_BUFFER_SIZE (1024 * 4)
+#define XAIE_TXN_STREAM_BUFFER_SIZE (1024U * 64U)
+#define XAIE_TXN_ARENA_MIN_SIZE (1024U * 16U)
+#define XAIE_TXN_ARENA_MAX_SIZE (1024U * 1024U)
 
 #define XAIE_TXN_INSTANCE_EXPORTED	0b10U
 #define XAIE_TXN_INST_EXPORTED_MASK XAIE_TXN_INSTANCE_EXPORTED
 #define XAIE_TXN_AUTO_FLUSH_MASK XAIE_TRANSACTION_ENABLE_AUTO_FLUSH
+#define XAIE_TXN_COALESCING_MASK XAIE_TRANSACTION_ENABLE_COALESCING
+#define XAIE_TXN_COLUMN_PARALLEL_MASK XAIE_TRANSACTION_ENABLE_COLUMN_PARALLEL
+#define XAIE_TXN_HASH_MULTIPLIER 0x9E3779B97F4A7C15ULL
+/* Minor version of transactions without native BlockSet32 operations */
+#define XAIE_TXN_HEADER_MINOR_NO_BLOCKSET 1U
+
+/**************************** Type Definitions *******************************/
+#ifdef __linux__
+/* Buffered output stream used to serialize transactions to a file */
+typedef struct {
+	int Fd;		/* File descriptor to write to */
+	u8 *Buf;	/* Stream buffer */
+	u32 Used;	/* Number of bytes pending in the buffer */
+} XAie_TxnStream;
+#endif
 
 /************************** Variable Definitions *****************************/
 const u8 TransactionHeaderVersion_Major = 0;
-const u8 TransactionHeaderVersion_Minor = 1;
+const u8 TransactionHeaderVersion_Minor = 2;
 
 /***************************** Macro Definitions *****************************/
 /************************** Function Definitions *****************************/
@@ -410,7 +439,26 @@ void _XAie_ClrBitInBitmap(u32 *Bitmap, u32 StartBit, u32 NumBit)
 
 /*****************************************************************************/
 /**
-* This API inserts a transaction node to the linked list.
+* This API returns the index of the hash bucket for a given thread id.
+*
+* @param        Tid: Thread id.
+*
+* @return       Index of the hash bucket.
+*
+* @note         Internal only. Thread ids are usually pointers or small
+*		integers, multiplicative hashing spreads both over the buckets.
+*
+******************************************************************************/
+static inline u32 _XAie_TxnHash(u64 Tid)
+{
+	return (u32)((Tid * XAIE_TXN_HASH_MULTIPLIER) >>
+			(64U - XAIE_TXN_HASH_BITS));
+}
+
+/*****************************************************************************/
+/**
+* This API inserts a transaction node to the linked list and to the hash bucket
+* of its thread id.
 *
 * @param        DevInst: Device Instance
 * @param        TxnNode: Pointer to the transaction node to be inserted
@@ -422,85 +470,130 @@ void _XAie_ClrBitInBitmap(u32 *Bitmap, u32 StartBit, u32 NumBit)
 ******************************************************************************/
 static void _XAie_AppendTxnInstToList(XAie_DevInst *DevInst, XAie_TxnInst *Inst)
 {
-	XAie_List *Node = &DevInst->TxnList;
+	XAie_List *Node = &DevInst->TxnHash[_XAie_TxnHash(Inst->Tid)];
+
+	_XAie_SyncLockTxnList(DevInst);
 
+	/* Head is checked without the lock by the IO helpers */
+	Inst->Node.Next = DevInst->TxnList.Next;
+	XAIE_ATOMIC_STORE(&DevInst->TxnList.Next, &Inst->Node);
+
+	/* Append to the bucket so the oldest instance of a thread wins */
 	while(Node->Next != NULL) {
 		Node = Node->Next;
 	}
 
-	Node->Next = &Inst->Node;
-	Inst->Node.Next = NULL;
+	Inst->HashNode.Next = NULL;
+	/* Bucket heads are checked without the lock by _XAie_GetTxnInst() */
+	XAIE_ATOMIC_STORE(&Node->Next, &Inst->HashNode);
+
+	_XAie_SyncUnlockTxnList(DevInst);
 }
 
 /*****************************************************************************/
 /**
-* This API returns the transaction list from the linked list based on the thread
-* id.
+* This API returns the transaction instance associated with a thread id. Only
+* the hash bucket of the thread id is searched.
 *
 * @param        DevInst: Device instance pointer
 * @param	Tid: Thread id.
 *
 * @return       Pointer to transaction instance on success and NULL on failure
 *
-* @note         Internal only.
+* @note         Internal only. The list lock is only taken when the bucket of
+*		the thread id is not empty. A thread only records to the
+*		instances it created, so an empty bucket cannot race with the
+*		creation of an instance for the same thread.
 *
 ******************************************************************************/
 static XAie_TxnInst *_XAie_GetTxnInst(XAie_DevInst *DevInst, u64 Tid)
 {
-	XAie_List *NodePtr = DevInst->TxnList.Next;
-	XAie_TxnInst *TxnInst;
+	XAie_List *Bucket = &DevInst->TxnHash[_XAie_TxnHash(Tid)];
+	XAie_List *NodePtr;
+	XAie_TxnInst *TxnInst = NULL;
+
+	if(XAIE_ATOMIC_LOAD(&Bucket->Next) == NULL) {
+		return NULL;
+	}
+
+	_XAie_SyncLockTxnList(DevInst);
 
+	NodePtr = Bucket->Next;
 	while(NodePtr != NULL) {
-		TxnInst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst, Node);
+		TxnInst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst, HashNode);
 		if(TxnInst->Tid == Tid) {
-			return TxnInst;
+			break;
 		}
 
+		TxnInst = NULL;
 		NodePtr = NodePtr->Next;
 	}
 
-	return NULL;
+	_XAie_SyncUnlockTxnList(DevInst);
+
+	return TxnInst;
 }
 
 /*****************************************************************************/
 /**
-* This API removes a node from the linked list if the thread id is found.
+* This API unlinks a node from a singly linked list.
 *
-* @param        DevInst: Device instance pointer
-* @param	Tid: Thread id.
+* @param        Head: Head of the list
+* @param	Node: Node to be removed.
 *
 * @return       XAIE_OK on success and error code on failure.
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_RemoveTxnInstFromList(XAie_DevInst *DevInst, u64 Tid)
+static AieRC _XAie_UnlinkNode(XAie_List *Head, XAie_List *Node)
 {
-	XAie_List *NodePtr = DevInst->TxnList.Next;
-	XAie_List *Prev = &DevInst->TxnList;
-	XAie_TxnInst *Inst;
-
-	while(NodePtr != NULL) {
-		Inst = (XAie_TxnInst *)XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst,
-				Node);
-		if(Inst->Tid == Tid) {
-			break;
-		}
+	XAie_List *Prev = Head;
 
-		Prev = NodePtr;
-		NodePtr = NodePtr->Next;
+	while((Prev->Next != NULL) && (Prev->Next != Node)) {
+		Prev = Prev->Next;
 	}
 
-	if(NodePtr == NULL) {
-		XAIE_ERROR("Cannot find node to delete from list\n");
+	if(Prev->Next == NULL) {
 		return XAIE_ERR;
-	} else {
-		Prev->Next = NodePtr->Next;
 	}
 
+	XAIE_ATOMIC_STORE(&Prev->Next, Node->Next);
+	Node->Next = NULL;
+
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API removes a transaction instance from the linked list and from the
+* hash bucket of its thread id.
+*
+* @param        DevInst: Device instance pointer
+* @param	Inst: Transaction instance to be removed.
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_RemoveTxnInstFromList(XAie_DevInst *DevInst,
+		XAie_TxnInst *Inst)
+{
+	AieRC RC = XAIE_OK;
+
+	_XAie_SyncLockTxnList(DevInst);
+	if((_XAie_UnlinkNode(&DevInst->TxnList, &Inst->Node) != XAIE_OK) ||
+			(_XAie_UnlinkNode(&DevInst->TxnHash[_XAie_TxnHash(Inst->Tid)],
+				&Inst->HashNode) != XAIE_OK)) {
+		XAIE_ERROR("Cannot find node to delete from list\n");
+		RC = XAIE_ERR;
+	}
+	_XAie_SyncUnlockTxnList(DevInst);
+
+	return RC;
+}
+
 int BuffHexDump(char* buff,size_t size) {
 	XAIE_DBG("Buff Info %p %d\n",buff,size);
 	for (int i = 0; i < size; ++i) {
@@ -515,6 +608,357 @@ static int TxnCmdDump(XAie_TxnCmd* cmd) {
 	return 0;
 }
 
+/*****************************************************************************/
+/**
+* This API returns the number of payload bytes owned by a command.
+*
+* @param        Cmd: Pointer to the transaction command
+*
+* @return       Size of the payload in bytes.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline u32 _XAie_TxnPayloadSize(const XAie_TxnCmd *Cmd)
+{
+	if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+		return Cmd->Size * (u32)sizeof(u32);
+	} else if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+		return Cmd->Size;
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+* This API adds a block of the given size to the payload arena of a
+* transaction instance and makes it the current block.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        BlockSize: Number of bytes in the new block
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnArenaAddBlock(XAie_TxnInst *TxnInst, u32 BlockSize)
+{
+	XAie_TxnArena *Arena;
+
+	Arena = (XAie_TxnArena *)malloc(sizeof(*Arena) + BlockSize);
+	if(Arena == NULL) {
+		XAIE_ERROR("Failed to allocate memory for transaction "
+				"payloads\n");
+		return XAIE_ERR;
+	}
+
+	Arena->Size = BlockSize;
+	Arena->Used = 0U;
+	Arena->Next = TxnInst->Arena;
+	TxnInst->Arena = Arena;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API grows the payload arena of a transaction instance. Block sizes
+* double up to XAIE_TXN_ARENA_MAX_SIZE, larger requests get a block of their
+* own size.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Size: Minimum number of bytes required in the new block
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnArenaGrow(XAie_TxnInst *TxnInst, u32 Size)
+{
+	u32 BlockSize = XAIE_TXN_ARENA_MIN_SIZE;
+
+	if(TxnInst->Arena != NULL) {
+		BlockSize = TxnInst->Arena->Size * 2U;
+		if(BlockSize > XAIE_TXN_ARENA_MAX_SIZE) {
+			BlockSize = XAIE_TXN_ARENA_MAX_SIZE;
+		}
+	}
+
+	if(BlockSize < Size) {
+		BlockSize = Size;
+	}
+
+	return _XAie_TxnArenaAddBlock(TxnInst, BlockSize);
+}
+
+/*****************************************************************************/
+/**
+* This API allocates memory for a command payload from the arena of the
+* transaction instance. Allocations are 8 byte aligned and are released
+* together when the arena is reset or freed.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Size: Number of bytes to allocate
+*
+* @return       Pointer to the allocated memory on success and NULL on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void *_XAie_TxnArenaAlloc(XAie_TxnInst *TxnInst, u32 Size)
+{
+	XAie_TxnArena *Arena = TxnInst->Arena;
+	u32 AlignedSize = (Size + (u32)sizeof(u64) - 1U) &
+		~((u32)sizeof(u64) - 1U);
+	void *Ptr;
+
+	if((Arena == NULL) || (Arena->Size - Arena->Used < AlignedSize)) {
+		if(_XAie_TxnArenaGrow(TxnInst, AlignedSize) != XAIE_OK) {
+			return NULL;
+		}
+		Arena = TxnInst->Arena;
+	}
+
+	Ptr = (u8 *)Arena->Data + Arena->Used;
+	Arena->Used += AlignedSize;
+
+	return Ptr;
+}
+
+/*****************************************************************************/
+/**
+* This API resizes a payload allocated from the arena of a transaction
+* instance. The payload is extended in place when it is the last allocation of
+* the current block and the block has room, otherwise it is copied to a new
+* allocation.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Ptr: Pointer to the payload
+* @param        OldSize: Current size of the payload in bytes
+* @param        NewSize: Required size of the payload in bytes
+*
+* @return       Pointer to the resized payload on success and NULL on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void *_XAie_TxnArenaExtend(XAie_TxnInst *TxnInst, void *Ptr,
+		u32 OldSize, u32 NewSize)
+{
+	XAie_TxnArena *Arena = TxnInst->Arena;
+	u32 Align = (u32)sizeof(u64) - 1U;
+	u32 OldAligned = (OldSize + Align) & ~Align;
+	u32 NewAligned = (NewSize + Align) & ~Align;
+	void *NewPtr;
+
+	if((Arena != NULL) &&
+			((u8 *)Ptr + OldAligned == (u8 *)Arena->Data + Arena->Used) &&
+			(Arena->Size - Arena->Used >= NewAligned - OldAligned)) {
+		Arena->Used += NewAligned - OldAligned;
+		return Ptr;
+	}
+
+	NewPtr = _XAie_TxnArenaAlloc(TxnInst, NewSize);
+	if(NewPtr == NULL) {
+		return NULL;
+	}
+
+	return memcpy(NewPtr, Ptr, OldSize);
+}
+
+/*****************************************************************************/
+/**
+* This API releases all the payloads of a transaction instance. The most
+* recent, and largest, block is kept for reuse.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnArenaReset(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnArena *Arena = TxnInst->Arena, *Next;
+
+	if(Arena == NULL) {
+		return;
+	}
+
+	Next = Arena->Next;
+	while(Next != NULL) {
+		XAie_TxnArena *Tmp = Next->Next;
+
+		free(Next);
+		Next = Tmp;
+	}
+
+	Arena->Next = NULL;
+	Arena->Used = 0U;
+}
+
+/*****************************************************************************/
+/**
+* This API frees the payload arena of a transaction instance.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnArenaFree(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnArena *Arena = TxnInst->Arena;
+
+	while(Arena != NULL) {
+		XAie_TxnArena *Next = Arena->Next;
+
+		free(Arena);
+		Arena = Next;
+	}
+
+	TxnInst->Arena = NULL;
+}
+
+/*****************************************************************************/
+/**
+* This API drops all the commands of a transaction instance after they were
+* flushed and releases their payloads.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnResetCmdBuf(XAie_TxnInst *TxnInst)
+{
+	TxnInst->NumCmds = 0U;
+	_XAie_TxnArenaReset(TxnInst);
+}
+
+/*****************************************************************************/
+/**
+* This API tries to merge a write, or a block write, with the last command of
+* the transaction instance. Writes to consecutive register offsets of the same
+* tile are merged in to a single block write.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        RegOff: Register offset of the first word
+* @param        Data: Pointer to the data to be written
+* @param        Size: Number of words to be written
+*
+* @return       1 if the write was merged, 0 otherwise.
+*
+* @note         Internal only. Only the last command is considered, so writes
+*		are never reordered across a MaskPoll or any other command.
+*
+******************************************************************************/
+static u8 _XAie_TxnCoalesceWrite(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, u64 RegOff, const u32 *Data, u32 Size)
+{
+	XAie_TxnCmd *Prev;
+	u32 *Buf;
+	u64 TileMask = ULONG_MAX << DevInst->DevProp.RowShift;
+
+	if(TxnInst->NumCmds == 0U) {
+		return 0U;
+	}
+
+	/* Block writes never cross a tile boundary */
+	if((RegOff & TileMask) != ((RegOff + (Size - 1U) * 4U) & TileMask)) {
+		return 0U;
+	}
+
+	Prev = &TxnInst->CmdBuf[TxnInst->NumCmds - 1U];
+	if((Prev->RegOff & TileMask) != (RegOff & TileMask)) {
+		return 0U;
+	}
+
+	if((Prev->Opcode == XAIE_IO_WRITE) && (Prev->Mask == 0U) &&
+			(Prev->RegOff + 4U == RegOff)) {
+		Buf = (u32 *)_XAie_TxnArenaAlloc(TxnInst,
+				(Size + 1U) * (u32)sizeof(u32));
+		if(Buf == NULL) {
+			return 0U;
+		}
+
+		Buf[0] = Prev->Value;
+		memcpy((void *)&Buf[1], (const void *)Data, Size * sizeof(u32));
+		Prev->Opcode = XAIE_IO_BLOCKWRITE;
+		Prev->DataPtr = (u64)(uintptr_t)Buf;
+		Prev->Size = Size + 1U;
+		Prev->Value = 0U;
+		return 1U;
+	}
+
+	if((Prev->Opcode == XAIE_IO_BLOCKWRITE) &&
+			(Prev->RegOff + Prev->Size * 4U == RegOff)) {
+		Buf = (u32 *)_XAie_TxnArenaExtend(TxnInst,
+				(void *)(uintptr_t)Prev->DataPtr,
+				Prev->Size * (u32)sizeof(u32),
+				(Prev->Size + Size) * (u32)sizeof(u32));
+		if(Buf == NULL) {
+			return 0U;
+		}
+
+		memcpy((void *)&Buf[Prev->Size], (const void *)Data,
+				Size * sizeof(u32));
+		Prev->DataPtr = (u64)(uintptr_t)Buf;
+		Prev->Size += Size;
+		return 1U;
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+* This API tries to fold a mask write in to the last command of the
+* transaction instance, if it is a mask write to the same register. Only mask
+* writes touching disjoint bits are folded, so a bit that is set and then
+* cleared, or the other way around, is never collapsed in to a single write.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        RegOff: Register offset
+* @param        Mask: Mask of the write
+* @param        Value: Value of the write
+*
+* @return       1 if the mask write was folded, 0 otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TxnCoalesceMaskWrite(XAie_TxnInst *TxnInst, u64 RegOff,
+		u32 Mask, u32 Value)
+{
+	XAie_TxnCmd *Prev;
+
+	if(TxnInst->NumCmds == 0U) {
+		return 0U;
+	}
+
+	Prev = &TxnInst->CmdBuf[TxnInst->NumCmds - 1U];
+	if((Prev->Opcode != XAIE_IO_WRITE) || (Prev->Mask == 0U) ||
+			(Mask == 0U) || (Prev->RegOff != RegOff) ||
+			((Prev->Mask | Prev->Value) & (Mask | Value))) {
+		return 0U;
+	}
+
+	Prev->Mask |= Mask;
+	Prev->Value |= Value;
+
+	return 1U;
+}
+
 /*****************************************************************************/
 /**
 * This API rellaocates the command buffer associated with the given transaction
@@ -579,6 +1023,10 @@ AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags)
 
 	Inst->NumCmds = 0U;
 	Inst->MaxCmds = XAIE_DEFAULT_NUM_CMDS;
+	Inst->Arena = NULL;
+	Inst->PatchPoints = NULL;
+	Inst->NumPatchPoints = 0U;
+	Inst->MaxPatchPoints = 0U;
 	Inst->Tid = Backend->Ops.GetTid();
 	Inst->NextCustomOp = XAIE_IO_CUSTOM_OP_BEGIN;
 
@@ -603,23 +1051,39 @@ AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags)
 *
 * @param        DevInst: Device instance pointer
 * @param        Cmd: Pointer to the transaction command structure
-* @param	Flags: Transaction instance flags
 *
 * @return       XAIE_OK on success and XAIE_ERR on failure.
 *
-* @note         Internal only.
+* @note         Internal only. Payloads are owned by the arena of the
+*		transaction instance and are not released here.
 *
 ******************************************************************************/
-static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
-		u32 Flags)
+AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd)
 {
 	AieRC RC;
 	const XAie_Backend *Backend = DevInst->Backend;
 
 	if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
-		// TBD hooking point for  custom op handler
-		XAIE_WARN("Custom OP Transaction %d handler hook point\n",Cmd->Opcode);
-		return XAIE_OK;
+		const XAie_TxnCustomOp *Op = NULL;
+
+		if(DevInst->TxnCustomOps != NULL) {
+			Op = &DevInst->TxnCustomOps[Cmd->Opcode -
+				XAIE_IO_CUSTOM_OP_BEGIN];
+		}
+
+		if((Op == NULL) || (Op->Handler == NULL)) {
+			XAIE_WARN("No handler for custom OP %d, skipping\n",
+					Cmd->Opcode);
+			return XAIE_OK;
+		}
+
+		RC = Op->Handler(DevInst, (u8)Cmd->Opcode,
+				(void *)(uintptr_t)Cmd->DataPtr, Cmd->Size,
+				Op->Priv);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Custom OP %d failed\n", Cmd->Opcode);
+		}
+		return RC;
 	}
 
 	switch(Cmd->Opcode)
@@ -651,10 +1115,6 @@ static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
 						Cmd->RegOff);
 				return RC;
 			}
-
-			if(!(Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
-				free((void *)Cmd->DataPtr);
-			}
 			break;
 		case XAIE_IO_BLOCKSET:
 			RC = Backend->Ops.BlockSet32((void *)DevInst->IOInst,
@@ -689,33 +1149,99 @@ static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
 
 /*****************************************************************************/
 /**
-* This API executes all the commands in the command buffer and resets the number
-* of commands.
+* This API submits a transaction to a backend executing transactions as a
+* whole, running the custom operations on the host. The commands between two
+* custom operations are submitted as a separate transaction.
 *
 * @param        DevInst: Device instance pointer
 * @param        TxnInst: Pointer to the transaction instance
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure
+* @return       XAIE_OK on success and error code on failure
 *
-* @note         Internal only. This API does not allocate, reallocate or free
-*		any buffer.
+* @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+static AieRC _XAie_Txn_SubmitSegments(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst)
 {
 	AieRC RC;
+	XAie_TxnInst Segment;
 	const XAie_Backend *Backend = DevInst->Backend;
+	u32 Start = 0U;
 
-	XAIE_DBG("Flushing %d commands from transaction buffer\n",
-			TxnInst->NumCmds);
+	Segment = *TxnInst;
+	for(u32 i = 0U; i <= TxnInst->NumCmds; i++) {
+		if((i < TxnInst->NumCmds) &&
+				(TxnInst->CmdBuf[i].Opcode < XAIE_IO_CUSTOM_OP_BEGIN)) {
+			continue;
+		}
+
+		if(i > Start) {
+			Segment.CmdBuf = &TxnInst->CmdBuf[Start];
+			Segment.NumCmds = i - Start;
+			RC = Backend->Ops.SubmitTxn(DevInst->IOInst, &Segment);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		if(i < TxnInst->NumCmds) {
+			RC = _XAie_ExecuteCmd(DevInst, &TxnInst->CmdBuf[i]);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		Start = i + 1U;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API executes all the commands in the command buffer and resets the number
+* of commands.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only. This API does not allocate, reallocate or free
+*		any buffer.
+*
+******************************************************************************/
+static AieRC _XAie_Txn_ExecuteCmdBuf(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst)
+{
+	AieRC RC;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	XAIE_DBG("Flushing %d commands from transaction buffer\n",
+			TxnInst->NumCmds);
+
+	/* Commands are issued without going through the shadow cache */
+	_XAie_ShadowInvalidateForCmds(DevInst, TxnInst->CmdBuf,
+			TxnInst->NumCmds);
 
 	if(Backend->Ops.SubmitTxn != NULL) {
-		return Backend->Ops.SubmitTxn(DevInst->IOInst, TxnInst);
+		if(DevInst->TxnCustomOps == NULL) {
+			return Backend->Ops.SubmitTxn(DevInst->IOInst, TxnInst);
+		}
+
+		return _XAie_Txn_SubmitSegments(DevInst, TxnInst);
+	}
+
+	if(TxnInst->Flags & XAIE_TXN_COLUMN_PARALLEL_MASK) {
+		RC = _XAie_TxnExecuteParallel(DevInst, TxnInst);
+		if(RC != XAIE_FEATURE_NOT_SUPPORTED) {
+			return RC;
+		}
 	}
 
 	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
-		RC = _XAie_ExecuteCmd(DevInst, &TxnInst->CmdBuf[i],
-				TxnInst->Flags);
+		RC = _XAie_ExecuteCmd(DevInst, &TxnInst->CmdBuf[i]);
 		if (RC != XAIE_OK) {
 			 return RC;
 		}
@@ -724,6 +1250,32 @@ static AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API executes all the commands in the command buffer with the device
+* lock held, so the commands of the transaction are not interleaved with the
+* accesses of other threads.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	AieRC RC;
+	u32 Token;
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	RC = _XAie_Txn_ExecuteCmdBuf(DevInst, TxnInst);
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 * This API executes all the commands in the command buffer and frees the
@@ -772,11 +1324,12 @@ AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
 		return XAIE_OK;
 	}
 
-	RC = _XAie_RemoveTxnInstFromList(DevInst, Tid);
+	RC = _XAie_RemoveTxnInstFromList(DevInst, Inst);
 	if(RC != XAIE_OK) {
 		return RC;
 	}
 
+	_XAie_TxnArenaFree(Inst);
 	free(Inst->CmdBuf);
 	free(Inst);
 	return XAIE_OK;
@@ -801,6 +1354,7 @@ XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
 {
 	XAie_TxnInst *Inst, *TmpInst;
 	const XAie_Backend *Backend = DevInst->Backend;
+	u32 PayloadSize = 0U;
 
 	TmpInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
 	if(TmpInst == NULL) {
@@ -827,24 +1381,30 @@ XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
 			(void *)TmpInst->CmdBuf,
 			TmpInst->NumCmds * sizeof(*Inst->CmdBuf));
 
+	/* Copy all the payloads to a single block sized for them */
+	Inst->Arena = NULL;
+	for(u32 i = 0U; i < TmpInst->NumCmds; i++) {
+		PayloadSize += (_XAie_TxnPayloadSize(&TmpInst->CmdBuf[i]) +
+				(u32)sizeof(u64) - 1U) & ~((u32)sizeof(u64) - 1U);
+	}
+
+	if((PayloadSize != 0U) &&
+			(_XAie_TxnArenaAddBlock(Inst, PayloadSize) != XAIE_OK)) {
+		free(Inst->CmdBuf);
+		free(Inst);
+		return NULL;
+	}
+
 	for(u32 i = 0U; i < TmpInst->NumCmds; i++) {
 		XAie_TxnCmd *TmpCmd = &TmpInst->CmdBuf[i];
 		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
-		if(TmpCmd->Opcode == XAIE_IO_BLOCKWRITE) {
-			Cmd->DataPtr = (u64)(uintptr_t)malloc(
-					sizeof(u32) * TmpCmd->Size);
-			if((void *)(uintptr_t)Cmd->DataPtr == NULL) {
-				XAIE_ERROR("Failed to allocate memory to copy "
-						"command %d\n", i);
-				free(Inst->CmdBuf);
-				free(Inst);
-				return NULL;
-			}
+		u32 Size = _XAie_TxnPayloadSize(TmpCmd);
 
+		if((Size != 0U) && ((void *)(uintptr_t)TmpCmd->DataPtr != NULL)) {
 			Cmd->DataPtr = (u64)(uintptr_t)memcpy(
-					(void *)Cmd->DataPtr,
-					(void *)TmpCmd->DataPtr,
-					sizeof(u32) * TmpCmd->Size);
+					_XAie_TxnArenaAlloc(Inst, Size),
+					(void *)(uintptr_t)TmpCmd->DataPtr,
+					Size);
 		}
 	}
 
@@ -854,15 +1414,20 @@ XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
 	Inst->NumCmds = TmpInst->NumCmds;
 	Inst->MaxCmds = TmpInst->MaxCmds;
 	Inst->Node.Next = NULL;
+	Inst->PatchPoints = NULL;
+	Inst->NumPatchPoints = 0U;
+	Inst->MaxPatchPoints = 0U;
+	Inst->HashNode.Next = NULL;
 
 	return Inst;
 }
 
 static inline void _XAie_CreateTxnHeader(XAie_DevInst *DevInst,
-		XAie_TxnHeader *Header)
+		XAie_TxnHeader *Header, u8 Minor)
 {
+	memset((void *)Header, 0, sizeof(*Header));
 	Header->Major = TransactionHeaderVersion_Major;
-	Header->Minor = TransactionHeaderVersion_Minor;
+	Header->Minor = Minor;
 	Header->DevGen = DevInst->DevProp.DevGen;
 	Header->NumRows = DevInst->NumRows;
 	Header->NumCols = DevInst->NumCols;
@@ -873,19 +1438,6 @@ static inline void _XAie_CreateTxnHeader(XAie_DevInst *DevInst,
 			Header->NumRows, Header->NumMemTileRows);
 }
 
-static inline u8 _XAie_GetRowfromRegOff(XAie_DevInst *DevInst, u64 RegOff)
-{
-	return RegOff & (~(ULONG_MAX << DevInst->DevProp.RowShift));
-}
-
-static inline u8 _XAie_GetColfromRegOff(XAie_DevInst *DevInst, u64 RegOff)
-{
-	u64 Mask = ((1 << DevInst->DevProp.ColShift) - 1) &
-			~((1 << DevInst->DevProp.RowShift) - 1);
-
-	return (RegOff & Mask) >> DevInst->DevProp.RowShift;
-}
-
 static inline void _XAie_AppendWrite32(XAie_DevInst *DevInst,
 		XAie_TxnCmd *Cmd, u8 *TxnPtr)
 {
@@ -929,7 +1481,6 @@ static inline void _XAie_AppendMaskPoll32(XAie_DevInst *DevInst,
 static inline void _XAie_AppendBlockWrite32(XAie_DevInst *DevInst,
 		XAie_TxnCmd *Cmd, u8 *TxnPtr)
 {
-	u8 *Payload = TxnPtr + sizeof(XAie_BlockWrite32Hdr);
 	XAie_BlockWrite32Hdr *Hdr = (XAie_BlockWrite32Hdr*)TxnPtr;
 
 	Hdr->RegOff = Cmd->RegOff;
@@ -937,69 +1488,195 @@ static inline void _XAie_AppendBlockWrite32(XAie_DevInst *DevInst,
 	Hdr->OpHdr.Col = _XAie_GetColfromRegOff(DevInst,Cmd->RegOff);
 	Hdr->OpHdr.Row = _XAie_GetRowfromRegOff(DevInst,Cmd->RegOff);
 	Hdr->OpHdr.Op = XAIE_IO_BLOCKWRITE;
-
-	memcpy((void *)Payload, (void *)Cmd->DataPtr,
-			Cmd->Size * sizeof(u32));
 }
 
 static inline void _XAie_AppendBlockSet32(XAie_DevInst *DevInst,
 		XAie_TxnCmd *Cmd, u8 *TxnPtr)
 {
-	u8 *Payload = TxnPtr + sizeof(XAie_BlockWrite32Hdr);
-	XAie_BlockWrite32Hdr *Hdr = (XAie_BlockWrite32Hdr*)TxnPtr;
+	XAie_BlockSet32Hdr *Hdr = (XAie_BlockSet32Hdr*)TxnPtr;
 
 	Hdr->RegOff = Cmd->RegOff;
-	Hdr->Size = sizeof(*Hdr) + Cmd->Size * sizeof(u32);
+	Hdr->Value = Cmd->Value;
+	Hdr->Count = Cmd->Size;
+	Hdr->Size = sizeof(*Hdr);
 	Hdr->OpHdr.Col = _XAie_GetColfromRegOff(DevInst,Cmd->RegOff);
 	Hdr->OpHdr.Row = _XAie_GetRowfromRegOff(DevInst,Cmd->RegOff);
-	Hdr->OpHdr.Op = XAIE_IO_BLOCKWRITE;
-
-	for (u32 i = 0U; i < Cmd->Size; i++) {
-		*((u32 *)Payload) = Cmd->Value;
-		Payload += 4;
-	}
+	Hdr->OpHdr.Op = XAIE_IO_BLOCKSET;
+	Hdr->Col = Hdr->OpHdr.Col;
+	Hdr->Row = Hdr->OpHdr.Row;
 }
 
 static inline void _XAie_AppendCustomOp(XAie_DevInst *DevInst,
 		XAie_TxnCmd *Cmd, u8 *TxnPtr)
 {
-	u8 *Payload = TxnPtr + sizeof(XAie_CustomOpHdr);
 	XAie_CustomOpHdr *Hdr = (XAie_CustomOpHdr*)TxnPtr;
+	(void)DevInst;
 
 	Hdr->Size = sizeof(*Hdr) + Cmd->Size * sizeof(u8);
 	Hdr->OpHdr.Op = Cmd->Opcode;
+}
 
-	for (u32 i = 0U; i < Cmd->Size; ++i, ++Payload) {
-		*(Payload) = *((u8*)Cmd->DataPtr + i);
+/*****************************************************************************/
+/**
+*
+* This api returns the size of the serialized header of a command. Payloads of
+* block writes and custom operations follow the header in the serialized
+* buffer and are accounted for by _XAie_TxnPayloadSize().
+*
+* @param	Cmd - Pointer to the transaction command.
+*
+* @return	Size of the header in bytes, 0 if the command cannot be
+*		serialized.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAie_TxnOpHdrSize(const XAie_TxnCmd *Cmd)
+{
+	if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+		return sizeof(XAie_CustomOpHdr);
+	}
+
+	switch(Cmd->Opcode) {
+	case XAIE_IO_WRITE:
+		return (Cmd->Mask != 0U) ? sizeof(XAie_MaskWrite32Hdr) :
+			sizeof(XAie_Write32Hdr);
+	case XAIE_IO_MASKPOLL:
+		return sizeof(XAie_MaskPoll32Hdr);
+	case XAIE_IO_BLOCKWRITE:
+		return sizeof(XAie_BlockWrite32Hdr);
+	case XAIE_IO_BLOCKSET:
+		return sizeof(XAie_BlockSet32Hdr);
+	default:
+		return 0U;
 	}
 }
 
-static u8* _XAie_ReallocTxnBuf(u8 *TxnPtr, u32 NewSize)
+/*****************************************************************************/
+/**
+*
+* This api serializes the header of a command.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Cmd - Pointer to the transaction command.
+* @param	OpPtr - Pointer to store the header, large enough to hold
+*		_XAie_TxnOpHdrSize() bytes.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnAppendOpHdr(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
+		u8 *OpPtr)
 {
-	u8 *Tmp;
-	Tmp =  (u8*)realloc((void*)TxnPtr, NewSize);
-	if(Tmp == NULL) {
-		XAIE_ERROR("Reallocation failed for txn buffer\n");
-		return NULL;
+	/* Keep reserved fields and padding deterministic */
+	memset(OpPtr, 0, _XAie_TxnOpHdrSize(Cmd));
+
+	if(Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
+		TxnCmdDump(Cmd);
+		_XAie_AppendCustomOp(DevInst, Cmd, OpPtr);
+		return;
 	}
 
-	return Tmp;
+	switch(Cmd->Opcode) {
+	case XAIE_IO_WRITE:
+		if(Cmd->Mask != 0U) {
+			_XAie_AppendMaskWrite32(DevInst, Cmd, OpPtr);
+		} else {
+			_XAie_AppendWrite32(DevInst, Cmd, OpPtr);
+		}
+		break;
+	case XAIE_IO_MASKPOLL:
+		_XAie_AppendMaskPoll32(DevInst, Cmd, OpPtr);
+		break;
+	case XAIE_IO_BLOCKWRITE:
+		_XAie_AppendBlockWrite32(DevInst, Cmd, OpPtr);
+		break;
+	case XAIE_IO_BLOCKSET:
+		_XAie_AppendBlockSet32(DevInst, Cmd, OpPtr);
+		break;
+	default:
+		break;
+	}
 }
 
 /*****************************************************************************/
 /**
 *
-* This api copies an existing transaction instance and returns a copy of the
-* instance with all the commands for users to save the commands and use them
-* at a later point.
+* This api computes the exact size of the serialized form of a transaction
+* instance, including the transaction header and the trailing padding.
+*
+* @param	TxnInst - Pointer to the transaction instance.
+* @param	TxnSize - Pointer to return the size in bytes.
+* @param	NumOps - Pointer to return the number of serialized operations.
+* @param	Minor - Pointer to return the minor header version. It is only
+*		raised to TransactionHeaderVersion_Minor if a BlockSet32
+*		operation is serialized, so other transactions stay readable
+*		by consumers of the previous version.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. Commands which cannot be serialized are
+*		skipped with a warning.
+*
+******************************************************************************/
+static AieRC _XAie_TxnSerializedSize(const XAie_TxnInst *TxnInst,
+		u32 *TxnSize, u32 *NumOps, u8 *Minor)
+{
+	u64 Size = sizeof(XAie_TxnHeader);
+
+	*NumOps = 0U;
+	*Minor = XAIE_TXN_HEADER_MINOR_NO_BLOCKSET;
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u32 HdrSize = _XAie_TxnOpHdrSize(Cmd);
+
+		if(HdrSize == 0U) {
+			XAIE_WARN("Opcode %d cannot be serialized, skipping\n",
+					Cmd->Opcode);
+			continue;
+		}
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKSET) {
+			*Minor = TransactionHeaderVersion_Minor;
+		}
+
+		Size += HdrSize + _XAie_TxnPayloadSize(Cmd);
+		(*NumOps)++;
+	}
+
+	/* Round up to a word boundary, custom op payloads may be unaligned */
+	Size = (Size + 3U) & ~(u64)3U;
+	if(Size > UINT_MAX) {
+		XAIE_ERROR("Transaction of %lu bytes is too large to be "
+				"serialized\n", Size);
+		return XAIE_ERR;
+	}
+
+	*TxnSize = (u32)Size;
+	XAIE_DBG("Size of the transaction buffer being exported: %u bytes\n",
+			*TxnSize);
+	XAIE_DBG("Num of Operations in the transaction buffer: %u\n",
+			*NumOps);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api serializes the transaction instance of the calling thread into a
+* newly allocated buffer. The size of the buffer is computed from the command
+* buffer first, so the buffer is allocated exactly once.
 *
 * @param	DevInst - Device instance pointer.
 * @param	NumConsumers - Number of consumers for the generated
 *		transactions (Unused for now)
 * @param	Flags - Flags (Unused for now)
 *
-* @return	Pointer to copy of transaction instance on success and NULL
-*		on error.
+* @return	Pointer to the serialized transaction on success and NULL on
+*		error.
 *
 * @note		Internal only.
 *
@@ -1009,9 +1686,10 @@ u8* _XAie_TxnExportSerialized(XAie_DevInst *DevInst, u8 NumConsumers,
 {
 	const XAie_Backend *Backend = DevInst->Backend;
 	XAie_TxnInst *TmpInst;
-	u8 *TxnPtr;
-	u32 BuffSize = 0U, NumOps = 0;
-	u32 AllocatedBuffSize = XAIE_DEFAULT_TXN_BUFFER_SIZE;
+	XAie_TxnHeader *Header;
+	u8 *TxnPtr, *OpPtr;
+	u32 TxnSize, NumOps;
+	u8 Minor;
 	(void)NumConsumers;
 	(void)Flags;
 
@@ -1022,214 +1700,944 @@ u8* _XAie_TxnExportSerialized(XAie_DevInst *DevInst, u8 NumConsumers,
 		return NULL;
 	}
 
-	TxnPtr = malloc(AllocatedBuffSize);
+	if(_XAie_TxnSerializedSize(TmpInst, &TxnSize, &NumOps,
+				&Minor) != XAIE_OK) {
+		return NULL;
+	}
+
+	TxnPtr = malloc(TxnSize);
 	if(TxnPtr == NULL) {
 		XAIE_ERROR("Malloc failed\n");
 		return NULL;
 	}
 
-	_XAie_CreateTxnHeader(DevInst, (XAie_TxnHeader *)TxnPtr);
-	BuffSize += sizeof(XAie_TxnHeader);
-	TxnPtr += sizeof(XAie_TxnHeader);
-	XAIE_DBG("number of cmd %d\n", TmpInst->NumCmds);
+	Header = (XAie_TxnHeader *)TxnPtr;
+	_XAie_CreateTxnHeader(DevInst, Header, Minor);
+	Header->NumOps = NumOps;
+	Header->TxnSize = TxnSize;
 
+	OpPtr = TxnPtr + sizeof(*Header);
 	for(u32 i = 0U; i < TmpInst->NumCmds; i++) {
-		NumOps++;
 		XAie_TxnCmd *Cmd = &TmpInst->CmdBuf[i];
-		if ((Cmd->Opcode == XAIE_IO_WRITE) && (!Cmd->Mask)) {
-			if((BuffSize + sizeof(XAie_Write32Hdr)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2);
-				if(TxnPtr == NULL) return NULL;
-				AllocatedBuffSize *= 2;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendWrite32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_Write32Hdr);
-			BuffSize += sizeof(XAie_Write32Hdr);
+		u32 HdrSize = _XAie_TxnOpHdrSize(Cmd);
+		u32 PayloadSize = _XAie_TxnPayloadSize(Cmd);
+
+		if(HdrSize == 0U) {
 			continue;
 		}
-		if ((Cmd->Opcode == XAIE_IO_WRITE) && (Cmd->Mask)) {
-			if((BuffSize + sizeof(XAie_MaskWrite32Hdr)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2);
-				if(TxnPtr == NULL) return NULL;
-				AllocatedBuffSize *= 2;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendMaskWrite32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_MaskWrite32Hdr);
-			BuffSize += sizeof(XAie_MaskWrite32Hdr);
-			continue;
+
+		_XAie_TxnAppendOpHdr(DevInst, Cmd, OpPtr);
+		OpPtr += HdrSize;
+		if(PayloadSize != 0U) {
+			memcpy((void *)OpPtr, (void *)(uintptr_t)Cmd->DataPtr,
+					PayloadSize);
+			OpPtr += PayloadSize;
 		}
-		if (Cmd->Opcode == XAIE_IO_MASKPOLL) {
-			if((BuffSize + sizeof(XAie_MaskPoll32Hdr)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2);
-				if(TxnPtr == NULL) return NULL;
-				AllocatedBuffSize *= 2;
-				TxnPtr += BuffSize;
+	}
+
+	memset(OpPtr, 0, (size_t)(TxnPtr + TxnSize - OpPtr));
+
+	return TxnPtr;
+}
+
+#ifdef __linux__
+/*****************************************************************************/
+/**
+*
+* This api writes a buffer to a file descriptor, retrying on partial writes
+* and interrupted system calls.
+*
+* @param	Fd - File descriptor.
+* @param	Data - Pointer to the data.
+* @param	Size - Number of bytes to write.
+*
+* @return	XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnWriteFd(int Fd, const u8 *Data, u32 Size)
+{
+	while(Size > 0U) {
+		ssize_t Ret = write(Fd, Data, Size);
+
+		if(Ret < 0) {
+			if(errno == EINTR) {
+				continue;
 			}
-			_XAie_AppendMaskPoll32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_MaskPoll32Hdr);
-			BuffSize += sizeof(XAie_MaskPoll32Hdr);
-			continue;
+
+			XAIE_ERROR("Failed to write transaction, %d: %s\n",
+					errno, strerror(errno));
+			return XAIE_ERR;
 		}
-		if (Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
-			if((BuffSize + sizeof(XAie_BlockWrite32Hdr) +
-						Cmd->Size * sizeof(u32)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2);
-				if(TxnPtr == NULL) return NULL;
-				AllocatedBuffSize *= 2;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendBlockWrite32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_BlockWrite32Hdr) +
-				Cmd->Size * sizeof(u32);
-			BuffSize += sizeof(XAie_BlockWrite32Hdr) +
-				Cmd->Size * sizeof(u32);
-			continue;
+
+		Data += Ret;
+		Size -= (u32)Ret;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api appends data to a transaction stream. The stream buffer is written
+* out when full. Data which does not fit in the stream buffer is written to the
+* file descriptor directly, without being copied.
+*
+* @param	Stream - Pointer to the transaction stream.
+* @param	Data - Pointer to the data.
+* @param	Size - Number of bytes to append.
+*
+* @return	XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnStreamPut(XAie_TxnStream *Stream, const void *Data,
+		u32 Size)
+{
+	AieRC RC;
+
+	if(Size > XAIE_TXN_STREAM_BUFFER_SIZE - Stream->Used) {
+		RC = _XAie_TxnWriteFd(Stream->Fd, Stream->Buf, Stream->Used);
+		if(RC != XAIE_OK) {
+			return RC;
 		}
-		if (Cmd->Opcode == XAIE_IO_BLOCKSET) {
-			/*
-			 * Blockset gets converted to blockwrite. so check for
-			 * blockwrite size
-			 */
-			if((BuffSize + sizeof(XAie_BlockWrite32Hdr) +
-						Cmd->Size * sizeof(u32)) >
-					AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2);
-				if(TxnPtr == NULL) return NULL;
-				AllocatedBuffSize *= 2;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendBlockSet32(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_BlockWrite32Hdr) +
-				Cmd->Size * sizeof(u32);
-			BuffSize += sizeof(XAie_BlockWrite32Hdr) +
-				Cmd->Size * sizeof(u32);
-			continue;
+
+		Stream->Used = 0U;
+		if(Size >= XAIE_TXN_STREAM_BUFFER_SIZE) {
+			return _XAie_TxnWriteFd(Stream->Fd, (const u8 *)Data,
+					Size);
 		}
-		if (Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
-			TxnCmdDump(Cmd);
-			XAIE_DBG("Size of the CustomOp Hdr being exported: %u bytes\n", sizeof(XAie_CustomOpHdr));
-
-			if((BuffSize + sizeof(XAie_CustomOpHdr) +
-						Cmd->Size) > AllocatedBuffSize) {
-				TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize,
-						AllocatedBuffSize * 2);
-				if(TxnPtr == NULL) return NULL;
-				AllocatedBuffSize *= 2;
-				TxnPtr += BuffSize;
-			}
-			_XAie_AppendCustomOp(DevInst, Cmd, TxnPtr);
-			TxnPtr += sizeof(XAie_CustomOpHdr) +
-				Cmd->Size * sizeof(u8);
-			BuffSize += sizeof(XAie_CustomOpHdr) +
-				Cmd->Size * sizeof(u8);
+	}
+
+	memcpy(Stream->Buf + Stream->Used, Data, Size);
+	Stream->Used += Size;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api serializes the transaction instance of the calling thread and
+* streams it to a file descriptor through a fixed size buffer. The serialized
+* stream is identical to the buffer returned by _XAie_TxnExportSerialized().
+*
+* @param	DevInst - Device instance pointer.
+* @param	Fd - File descriptor opened for writing.
+* @param	NumConsumers - Number of consumers for the generated
+*		transactions (Unused for now)
+* @param	Flags - Flags (Unused for now)
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. The header is written first, so the file
+*		descriptor does not need to be seekable.
+*
+******************************************************************************/
+AieRC _XAie_TxnExportSerializedToFd(XAie_DevInst *DevInst, int Fd,
+		u8 NumConsumers, u32 Flags)
+{
+	AieRC RC;
+	const XAie_Backend *Backend = DevInst->Backend;
+	XAie_TxnInst *TmpInst;
+	XAie_TxnHeader Header;
+	XAie_TxnStream Stream;
+	u32 TxnSize, NumOps, StreamSize;
+	u8 Minor;
+	union {
+		XAie_Write32Hdr Write;
+		XAie_MaskWrite32Hdr MaskWrite;
+		XAie_MaskPoll32Hdr MaskPoll;
+		XAie_BlockWrite32Hdr BlockWrite;
+		XAie_BlockSet32Hdr BlockSet;
+		XAie_CustomOpHdr CustomOp;
+	} OpHdr;
+	const u32 Pad = 0U;
+	(void)NumConsumers;
+	(void)Flags;
+
+	TmpInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+	if(TmpInst == NULL) {
+		XAIE_ERROR("Failed to get the correct transaction instance "
+				"from internal list\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_TxnSerializedSize(TmpInst, &TxnSize, &NumOps, &Minor);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Stream.Fd = Fd;
+	Stream.Used = 0U;
+	Stream.Buf = (u8 *)malloc(XAIE_TXN_STREAM_BUFFER_SIZE);
+	if(Stream.Buf == NULL) {
+		XAIE_ERROR("Malloc failed\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_CreateTxnHeader(DevInst, &Header, Minor);
+	Header.NumOps = NumOps;
+	Header.TxnSize = TxnSize;
+	RC = _XAie_TxnStreamPut(&Stream, &Header, sizeof(Header));
+	StreamSize = sizeof(Header);
+
+	for(u32 i = 0U; (i < TmpInst->NumCmds) && (RC == XAIE_OK); i++) {
+		XAie_TxnCmd *Cmd = &TmpInst->CmdBuf[i];
+		u32 HdrSize = _XAie_TxnOpHdrSize(Cmd);
+		u32 PayloadSize = _XAie_TxnPayloadSize(Cmd);
+
+		if(HdrSize == 0U) {
 			continue;
 		}
+
+		_XAie_TxnAppendOpHdr(DevInst, Cmd, (u8 *)&OpHdr);
+		RC = _XAie_TxnStreamPut(&Stream, &OpHdr, HdrSize);
+		if((RC == XAIE_OK) && (PayloadSize != 0U)) {
+			RC = _XAie_TxnStreamPut(&Stream,
+					(const void *)(uintptr_t)Cmd->DataPtr,
+					PayloadSize);
+		}
+		StreamSize += HdrSize + PayloadSize;
 	}
 
-	BuffSize = (BuffSize % 4) ? (BuffSize / 4 + 1) : BuffSize;
-	XAIE_DBG("Size of the Txn Hdr being exported: %u bytes\n",
-			sizeof(XAie_TxnHeader));
-	XAIE_DBG("Size of the transaction buffer being exported: %u bytes\n",
-			BuffSize);
-	XAIE_DBG("Num of Operations in the transaction buffer: %u\n",
-			TmpInst->NumCmds);
+	if(RC == XAIE_OK) {
+		RC = _XAie_TxnStreamPut(&Stream, &Pad, TxnSize - StreamSize);
+	}
+
+	if(RC == XAIE_OK) {
+		RC = _XAie_TxnWriteFd(Stream.Fd, Stream.Buf, Stream.Used);
+	}
+
+	free(Stream.Buf);
+
+	return RC;
+}
+#else
+AieRC _XAie_TxnExportSerializedToFd(XAie_DevInst *DevInst, int Fd,
+		u8 NumConsumers, u32 Flags)
+{
+	(void)DevInst;
+	(void)Fd;
+	(void)NumConsumers;
+	(void)Flags;
+
+	XAIE_ERROR("Streaming transactions to a file descriptor is only "
+			"supported on Linux\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+#endif /* __linux__ */
+
+void _XAie_FreeTxnPtr(void *Ptr)
+{
+	free(Ptr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api validates the header of a serialized transaction buffer against the
+* device instance it is about to be replayed on.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Header - Pointer to the serialized transaction header.
+* @param	BufSize - Size of the serialized transaction buffer in bytes.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnCheckHeader(XAie_DevInst *DevInst,
+		const XAie_TxnHeader *Header, u32 BufSize)
+{
+	if(BufSize < sizeof(*Header)) {
+		XAIE_ERROR("Transaction buffer too small for the header\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Header->Major != TransactionHeaderVersion_Major) ||
+			(Header->Minor > TransactionHeaderVersion_Minor)) {
+		XAIE_ERROR("Unsupported transaction version %d.%d\n",
+				Header->Major, Header->Minor);
+		return XAIE_ERR;
+	}
+
+	if(Header->DevGen != DevInst->DevProp.DevGen) {
+		XAIE_ERROR("Transaction generated for device generation %d, "
+				"expected %d\n", Header->DevGen,
+				DevInst->DevProp.DevGen);
+		return XAIE_INVALID_DEVICE;
+	}
+
+	if((Header->NumRows != DevInst->NumRows) ||
+			(Header->NumMemTileRows != DevInst->MemTileNumRows) ||
+			(Header->NumCols > DevInst->NumCols)) {
+		XAIE_ERROR("Transaction generated for (%d, %d, %d) "
+				"cols, rows, memtile rows does not fit the "
+				"partition\n", Header->NumCols,
+				Header->NumRows, Header->NumMemTileRows);
+		return XAIE_INVALID_DEVICE;
+	}
+
+	if((Header->TxnSize < sizeof(*Header)) ||
+			(Header->TxnSize > BufSize)) {
+		XAIE_ERROR("Invalid transaction size %d, buffer size %d\n",
+				Header->TxnSize, BufSize);
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Every operation takes at least an operation header */
+	if(Header->NumOps > (Header->TxnSize - sizeof(*Header)) /
+			sizeof(XAie_OpHdr)) {
+		XAIE_ERROR("Invalid number of operations %d for transaction "
+				"size %d\n", Header->NumOps, Header->TxnSize);
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api decodes one operation of a serialized transaction buffer into a
+* transaction command. Payloads are not copied, the DataPtr of the command
+* points into the serialized buffer.
+*
+* @param	OpPtr - Pointer to the serialized operation header.
+* @param	Remaining - Number of bytes left in the serialized buffer.
+* @param	Cmd - Pointer to the command to be populated.
+* @param	OpSize - Pointer to return the size of the serialized operation.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnDecodeOp(const u8 *OpPtr, u32 Remaining,
+		XAie_TxnCmd *Cmd, u32 *OpSize)
+{
+	const XAie_OpHdr *OpHdr = (const XAie_OpHdr *)OpPtr;
+
+	if(Remaining < sizeof(XAie_CustomOpHdr)) {
+		XAIE_ERROR("Truncated transaction operation\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memset((void *)Cmd, 0, sizeof(*Cmd));
+
+	if(OpHdr->Op >= XAIE_IO_CUSTOM_OP_BEGIN) {
+		const XAie_CustomOpHdr *Hdr = (const XAie_CustomOpHdr *)OpPtr;
+
+		if((Hdr->Size < sizeof(*Hdr)) || (Hdr->Size > Remaining)) {
+			XAIE_ERROR("Invalid size for custom op %d\n",
+					OpHdr->Op);
+			return XAIE_INVALID_ARGS;
+		}
+
+		Cmd->Opcode = (XAie_TxnOpcode)OpHdr->Op;
+		Cmd->Size = Hdr->Size - sizeof(*Hdr);
+		Cmd->DataPtr = (u64)(uintptr_t)(OpPtr + sizeof(*Hdr));
+		*OpSize = Hdr->Size;
+		return XAIE_OK;
+	}
+
+	switch(OpHdr->Op) {
+	case XAIE_IO_WRITE:
+	{
+		const XAie_Write32Hdr *Hdr = (const XAie_Write32Hdr *)OpPtr;
+
+		if((Remaining < sizeof(*Hdr)) || (Hdr->Size != sizeof(*Hdr))) {
+			break;
+		}
+
+		Cmd->Opcode = XAIE_IO_WRITE;
+		Cmd->RegOff = Hdr->RegOff;
+		Cmd->Value = Hdr->Value;
+		*OpSize = Hdr->Size;
+		return XAIE_OK;
+	}
+	case XAIE_IO_MASKWRITE:
+	{
+		const XAie_MaskWrite32Hdr *Hdr =
+			(const XAie_MaskWrite32Hdr *)OpPtr;
+
+		if((Remaining < sizeof(*Hdr)) || (Hdr->Size != sizeof(*Hdr))) {
+			break;
+		}
+
+		/* Mask writes are stored as writes with a non zero mask */
+		Cmd->Opcode = XAIE_IO_WRITE;
+		Cmd->RegOff = Hdr->RegOff;
+		Cmd->Mask = Hdr->Mask;
+		Cmd->Value = Hdr->Value;
+		*OpSize = Hdr->Size;
+		return XAIE_OK;
+	}
+	case XAIE_IO_MASKPOLL:
+	{
+		const XAie_MaskPoll32Hdr *Hdr =
+			(const XAie_MaskPoll32Hdr *)OpPtr;
+
+		if((Remaining < sizeof(*Hdr)) || (Hdr->Size != sizeof(*Hdr))) {
+			break;
+		}
+
+		Cmd->Opcode = XAIE_IO_MASKPOLL;
+		Cmd->RegOff = Hdr->RegOff;
+		Cmd->Mask = Hdr->Mask;
+		Cmd->Value = Hdr->Value;
+		Cmd->Size = 0U;
+		*OpSize = Hdr->Size;
+		return XAIE_OK;
+	}
+	case XAIE_IO_BLOCKWRITE:
+	{
+		const XAie_BlockWrite32Hdr *Hdr =
+			(const XAie_BlockWrite32Hdr *)OpPtr;
+
+		if((Remaining < sizeof(*Hdr)) || (Hdr->Size < sizeof(*Hdr)) ||
+				(Hdr->Size > Remaining) ||
+				((Hdr->Size - sizeof(*Hdr)) % sizeof(u32))) {
+			break;
+		}
+
+		Cmd->Opcode = XAIE_IO_BLOCKWRITE;
+		Cmd->RegOff = Hdr->RegOff;
+		Cmd->Size = (Hdr->Size - sizeof(*Hdr)) / sizeof(u32);
+		Cmd->DataPtr = (u64)(uintptr_t)(OpPtr + sizeof(*Hdr));
+		*OpSize = Hdr->Size;
+		return XAIE_OK;
+	}
+	case XAIE_IO_BLOCKSET:
+	{
+		const XAie_BlockSet32Hdr *Hdr =
+			(const XAie_BlockSet32Hdr *)OpPtr;
+
+		if((Remaining < sizeof(*Hdr)) || (Hdr->Size != sizeof(*Hdr))) {
+			break;
+		}
+
+		Cmd->Opcode = XAIE_IO_BLOCKSET;
+		Cmd->RegOff = Hdr->RegOff;
+		Cmd->Value = Hdr->Value;
+		Cmd->Size = Hdr->Count;
+		*OpSize = Hdr->Size;
+		return XAIE_OK;
+	}
+	default:
+		XAIE_ERROR("Invalid transaction opcode %d\n", OpHdr->Op);
+		return XAIE_INVALID_ARGS;
+	}
+
+	XAIE_ERROR("Invalid size for transaction opcode %d\n", OpHdr->Op);
+	return XAIE_INVALID_ARGS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api imports a serialized transaction buffer and converts it back to a
+* transaction instance. The returned instance is marked as exported, so it can
+* be submitted multiple times using XAie_SubmitTransaction.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnPtr - Pointer to the serialized transaction buffer.
+* @param	BufSize - Size of the serialized transaction buffer in bytes.
+*
+* @return	Pointer to transaction instance on success and NULL on error.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+XAie_TxnInst* _XAie_TxnImportSerialized(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 BufSize)
+{
+	AieRC RC;
+	XAie_TxnInst *Inst;
+	const XAie_TxnHeader *Header = (const XAie_TxnHeader *)TxnPtr;
+	const XAie_Backend *Backend = DevInst->Backend;
+	u32 Remaining, OpSize;
+
+	RC = _XAie_TxnCheckHeader(DevInst, Header, BufSize);
+	if(RC != XAIE_OK) {
+		return NULL;
+	}
+
+	Inst = (XAie_TxnInst *)malloc(sizeof(*Inst));
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to allocate memory for txn instance\n");
+		return NULL;
+	}
+
+	Inst->CmdBuf = (XAie_TxnCmd *)calloc(Header->NumOps + 1U,
+			sizeof(*Inst->CmdBuf));
+	if(Inst->CmdBuf == NULL) {
+		XAIE_ERROR("Failed to allocate memory for command buffer\n");
+		free(Inst);
+		return NULL;
+	}
+
+	Inst->Tid = Backend->Ops.GetTid();
+	Inst->Flags = XAIE_TXN_INSTANCE_EXPORTED;
+	Inst->NumCmds = 0U;
+	Inst->MaxCmds = Header->NumOps + 1U;
+	Inst->NextCustomOp = XAIE_IO_CUSTOM_OP_BEGIN;
+	Inst->Arena = NULL;
+	Inst->PatchPoints = NULL;
+	Inst->NumPatchPoints = 0U;
+	Inst->MaxPatchPoints = 0U;
+	Inst->Node.Next = NULL;
+	Inst->HashNode.Next = NULL;
+
+	/* Payloads are never larger than the serialized buffer */
+	if(_XAie_TxnArenaAddBlock(Inst, Header->TxnSize) != XAIE_OK) {
+		_XAie_TxnFree(Inst);
+		return NULL;
+	}
+
+	TxnPtr += sizeof(*Header);
+	Remaining = Header->TxnSize - sizeof(*Header);
+	for(u32 i = 0U; i < Header->NumOps; i++) {
+		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
+		u32 PayloadSize;
+
+		RC = _XAie_TxnDecodeOp(TxnPtr, Remaining, Cmd, &OpSize);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to decode operation %d\n", i);
+			_XAie_TxnFree(Inst);
+			return NULL;
+		}
+
+		if((Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) &&
+				(Cmd->Opcode >= Inst->NextCustomOp)) {
+			Inst->NextCustomOp = Cmd->Opcode + 1U;
+		}
+
+		PayloadSize = _XAie_TxnPayloadSize(Cmd);
+		if(PayloadSize != 0U) {
+			void *Payload = _XAie_TxnArenaAlloc(Inst, PayloadSize);
+
+			if(Payload == NULL) {
+				XAIE_ERROR("Failed to allocate memory for "
+						"operation %d payload\n", i);
+				_XAie_TxnFree(Inst);
+				return NULL;
+			}
+
+			Cmd->DataPtr = (u64)(uintptr_t)memcpy(Payload,
+					(void *)(uintptr_t)Cmd->DataPtr,
+					PayloadSize);
+		} else {
+			Cmd->DataPtr = 0U;
+		}
+
+		Inst->NumCmds++;
+		TxnPtr += OpSize;
+		Remaining -= OpSize;
+	}
+
+	return Inst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api replays a serialized transaction buffer on the device instance. Each
+* operation is decoded in place and issued to the IO backend, no intermediate
+* transaction instance is allocated.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnPtr - Pointer to the serialized transaction buffer.
+* @param	BufSize - Size of the serialized transaction buffer in bytes.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnExecuteSerialized(XAie_DevInst *DevInst, const u8 *TxnPtr,
+		u32 BufSize)
+{
+	AieRC RC;
+	XAie_TxnCmd Cmd;
+	const XAie_TxnHeader *Header = (const XAie_TxnHeader *)TxnPtr;
+	u32 Remaining, OpSize, Token;
+
+	RC = _XAie_TxnCheckHeader(DevInst, Header, BufSize);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
+
+	TxnPtr += sizeof(*Header);
+	Remaining = Header->TxnSize - sizeof(*Header);
+	for(u32 i = 0U; i < Header->NumOps; i++) {
+		RC = _XAie_TxnDecodeOp(TxnPtr, Remaining, &Cmd, &OpSize);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to decode operation %d\n", i);
+			break;
+		}
+
+		/* Operations are issued without going through the cache */
+		_XAie_ShadowInvalidateForCmds(DevInst, &Cmd, 1U);
+		RC = _XAie_ExecuteCmd(DevInst, &Cmd);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to execute operation %d\n", i);
+			break;
+		}
+
+		TxnPtr += OpSize;
+		Remaining -= OpSize;
+	}
+
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api releases the memory resources used by exported transaction instance.
+*
+* @param	TxnInst - Existing Transaction instance
+*
+* @return	XAIE_OK on success or error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnFree(XAie_TxnInst *Inst)
+{
+	if(!(Inst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
+		XAIE_ERROR("The transaction instance was not exported, it's "
+				"resources cannot be released\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_TxnArenaFree(Inst);
+	free(Inst->PatchPoints);
+	free(Inst->CmdBuf);
+	free(Inst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api finds the last command of a transaction instance which writes the
+* given field of a register and records it as a patch point.
+*
+* @param	TxnInst - Exported transaction instance.
+* @param	RegOff - Partition relative register offset.
+* @param	Mask - Mask of the field within the register.
+* @param	Shift - Right shift applied to the patch value.
+* @param	Slot - Pointer to return the patch point index.
+*
+* @return	XAIE_OK on success or error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnAddPatchPoint(XAie_TxnInst *TxnInst, u64 RegOff, u32 Mask,
+		u8 Shift, u32 *Slot)
+{
+	XAie_TxnPatchPoint *Point;
+
+	if(!(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
+		XAIE_ERROR("Patch points can only be added to exported "
+				"transaction instances\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = TxnInst->NumCmds; i > 0U; i--) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i - 1U];
+		u64 End = Cmd->RegOff + (u64)Cmd->Size * sizeof(u32);
+		u32 WordIdx = 0U;
+
+		if((Cmd->Opcode == XAIE_IO_WRITE) && (Cmd->RegOff == RegOff)) {
+			if((Cmd->Mask != 0U) && ((Mask & ~Cmd->Mask) != 0U)) {
+				XAIE_ERROR("Field is not written by the mask "
+						"write to 0x%lx\n", RegOff);
+				return XAIE_INVALID_ARGS;
+			}
+		} else if((Cmd->Opcode == XAIE_IO_BLOCKWRITE) &&
+				(RegOff >= Cmd->RegOff) && (RegOff < End)) {
+			WordIdx = (u32)((RegOff - Cmd->RegOff) / sizeof(u32));
+		} else if((Cmd->Opcode == XAIE_IO_BLOCKSET) &&
+				(RegOff >= Cmd->RegOff) && (RegOff < End)) {
+			XAIE_ERROR("Register 0x%lx is written by a block set and "
+					"cannot be patched\n", RegOff);
+			return XAIE_INVALID_ARGS;
+		} else {
+			continue;
+		}
+
+		if(TxnInst->NumPatchPoints == TxnInst->MaxPatchPoints) {
+			u32 MaxPoints = (TxnInst->MaxPatchPoints == 0U) ? 8U :
+				TxnInst->MaxPatchPoints * 2U;
+
+			Point = (XAie_TxnPatchPoint *)realloc(
+					TxnInst->PatchPoints,
+					MaxPoints * sizeof(*Point));
+			if(Point == NULL) {
+				XAIE_ERROR("Failed to allocate memory for patch "
+						"points\n");
+				return XAIE_ERR;
+			}
+
+			TxnInst->PatchPoints = Point;
+			TxnInst->MaxPatchPoints = MaxPoints;
+		}
+
+		Point = &TxnInst->PatchPoints[TxnInst->NumPatchPoints];
+		Point->CmdIdx = i - 1U;
+		Point->WordIdx = WordIdx;
+		Point->Mask = Mask;
+		Point->Lsb = (u8)(first_set_bit(Mask) - 1U);
+		Point->Shift = Shift;
+
+		*Slot = TxnInst->NumPatchPoints++;
+		return XAIE_OK;
+	}
+
+	XAIE_ERROR("Register 0x%lx is not written by the transaction\n",
+			RegOff);
+	return XAIE_INVALID_ARGS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api writes a new value to a patch point of a transaction instance. The
+* value is shifted right by the shift of the patch point and placed at the
+* field position, bits which do not fit in the field are dropped. Other bits
+* of the command are preserved.
+*
+* @param	TxnInst - Exported transaction instance.
+* @param	Slot - Patch point index returned by _XAie_TxnAddPatchPoint.
+* @param	Value - New value of the field.
+*
+* @return	XAIE_OK on success or error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnPatch(XAie_TxnInst *TxnInst, u32 Slot, u64 Value)
+{
+	const XAie_TxnPatchPoint *Point;
+	XAie_TxnCmd *Cmd;
+	u32 *Word;
+
+	if(Slot >= TxnInst->NumPatchPoints) {
+		XAIE_ERROR("Invalid patch point %d\n", Slot);
+		return XAIE_INVALID_ARGS;
+	}
+
+	Point = &TxnInst->PatchPoints[Slot];
+	Cmd = &TxnInst->CmdBuf[Point->CmdIdx];
+	if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+		Word = (u32 *)(uintptr_t)Cmd->DataPtr + Point->WordIdx;
+	} else {
+		Word = &Cmd->Value;
+	}
+
+	*Word = (*Word & ~Point->Mask) |
+		XAie_SetField(Value >> Point->Shift, Point->Lsb, Point->Mask);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api cleansup all the resources when the device instance is closed.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst)
+{
+	XAie_List *NodePtr = DevInst->TxnList.Next;
+	XAie_TxnInst *TxnInst;
+
+	while(NodePtr != NULL) {
+		TxnInst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst, Node);
+
+		if (TxnInst == NULL) {
+			continue;
+		}
+
+		NodePtr = NodePtr->Next;
+		_XAie_TxnArenaFree(TxnInst);
+		free(TxnInst->CmdBuf);
+		free(TxnInst);
+	}
+
+	DevInst->TxnList.Next = NULL;
+	for(u32 i = 0U; i < XAIE_TXN_HASH_BUCKETS; i++) {
+		DevInst->TxnHash[i].Next = NULL;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* These apis issue register accesses to the IO backend, going through the
+* shadow register cache if it is enabled for the device instance. The lock of
+* the accessed column is held for the duration of the access when the device
+* instance is thread safe.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative register offset
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline AieRC _XAie_IOWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Value)
+{
+	AieRC RC;
+	u32 Token = _XAie_SyncAcquire(DevInst, RegOff, sizeof(u32));
+
+	if(DevInst->ShadowCache != NULL) {
+		RC = _XAie_ShadowWrite32(DevInst, RegOff, Value);
+	} else {
+		RC = DevInst->Backend->Ops.Write32(DevInst->IOInst, RegOff,
+				Value);
+	}
+
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
+static inline AieRC _XAie_IORead32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 *Data)
+{
+	AieRC RC;
+	u32 Token = _XAie_SyncAcquire(DevInst, RegOff, sizeof(u32));
+
+	RC = DevInst->Backend->Ops.Read32(DevInst->IOInst, RegOff, Data);
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
+static inline AieRC _XAie_IOMaskWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Mask, u32 Value)
+{
+	AieRC RC;
+	u32 Token = _XAie_SyncAcquire(DevInst, RegOff, sizeof(u32));
+
+	if(DevInst->ShadowCache != NULL) {
+		RC = _XAie_ShadowMaskWrite32(DevInst, RegOff, Mask, Value);
+	} else {
+		RC = DevInst->Backend->Ops.MaskWrite32(DevInst->IOInst, RegOff,
+				Mask, Value);
+	}
+
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
+static inline AieRC _XAie_IOMaskPoll(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Mask, u32 Value, u32 TimeOutUs)
+{
+	AieRC RC;
+	u32 Token = _XAie_SyncAcquire(DevInst, RegOff, sizeof(u32));
+
+	RC = DevInst->Backend->Ops.MaskPoll(DevInst->IOInst, RegOff, Mask,
+			Value, TimeOutUs);
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
+static inline AieRC _XAie_IOBlockWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	AieRC RC;
+	u32 Token = _XAie_SyncAcquire(DevInst, RegOff, Size * sizeof(u32));
 
+	if(DevInst->ShadowCache != NULL) {
+		RC = _XAie_ShadowBlockWrite32(DevInst, RegOff, Data, Size);
+	} else {
+		RC = DevInst->Backend->Ops.BlockWrite32(DevInst->IOInst,
+				RegOff, Data, Size);
+	}
 
-	/* Adjust pointer and reallocate to the right size */
-	TxnPtr = _XAie_ReallocTxnBuf(TxnPtr - BuffSize, BuffSize);
-	((XAie_TxnHeader *)TxnPtr)->NumOps =  NumOps;
-	((XAie_TxnHeader *)TxnPtr)->TxnSize =  BuffSize;
+	_XAie_SyncRelease(DevInst, Token);
 
-	return (u8 *)TxnPtr;
+	return RC;
 }
 
-void _XAie_FreeTxnPtr(void *Ptr)
+static inline AieRC _XAie_IOBlockSet32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Data, u32 Size)
 {
-	free(Ptr);
+	AieRC RC;
+	u32 Token = _XAie_SyncAcquire(DevInst, RegOff, Size * sizeof(u32));
+
+	if(DevInst->ShadowCache != NULL) {
+		RC = _XAie_ShadowBlockSet32(DevInst, RegOff, Data, Size);
+	} else {
+		RC = DevInst->Backend->Ops.BlockSet32(DevInst->IOInst, RegOff,
+				Data, Size);
+	}
+
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
 }
 
-/*****************************************************************************/
-/**
-*
-* This api releases the memory resources used by exported transaction instance.
-*
-* @param	TxnInst - Existing Transaction instance
-*
-* @return	XAIE_OK on success or error code on failure.
-*
-* @note		Internal only.
-*
-******************************************************************************/
-AieRC _XAie_TxnFree(XAie_TxnInst *Inst)
+static inline AieRC _XAie_IOBlockRead32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 *Data, u32 Size)
 {
-	if(!(Inst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
-		XAIE_ERROR("The transaction instance was not exported, it's "
-				"resources cannot be released\n");
-		return XAIE_ERR;
-	}
+	const XAie_Backend *Backend = DevInst->Backend;
+	AieRC RC = XAIE_OK;
+	u32 Token = _XAie_SyncAcquire(DevInst, RegOff, Size * sizeof(u32));
 
-	for(u32 i = 0; i < Inst->NumCmds; i++) {
-		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
-		if((Cmd->Opcode == XAIE_IO_BLOCKWRITE || Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) &&
-				((void *)(uintptr_t)Cmd->DataPtr != NULL)) {
-			free((void *)(uintptr_t)Cmd->DataPtr);
+	if(Backend->Ops.BlockRead32 != NULL) {
+		RC = Backend->Ops.BlockRead32(DevInst->IOInst, RegOff, Data,
+				Size);
+	} else {
+		for(u32 i = 0U; (i < Size) && (RC == XAIE_OK); i++) {
+			RC = Backend->Ops.Read32(DevInst->IOInst,
+					RegOff + i * 4U, &Data[i]);
 		}
 	}
 
-	free(Inst->CmdBuf);
-	free(Inst);
+	_XAie_SyncRelease(DevInst, Token);
 
-	return XAIE_OK;
+	return RC;
 }
 
-/*****************************************************************************/
-/**
-*
-* This api cleansup all the resources when the device instance is closed.
-*
-* @param	DevInst - Device instance pointer.
-*
-* @return	None.
-*
-* @note		Internal only.
-*
-******************************************************************************/
-void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst)
+static inline AieRC _XAie_IOCmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row,
+		u8 Command, u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
 {
-	XAie_List *NodePtr = DevInst->TxnList.Next;
-	XAie_TxnInst *TxnInst;
-
-	while(NodePtr != NULL) {
-		TxnInst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst, Node);
-
-		if (TxnInst == NULL) {
-			continue;
-		}
+	AieRC RC;
+	u32 Token = _XAie_SyncAcquire(DevInst,
+			_XAie_GetTileAddr(DevInst, Row, Col), sizeof(u32));
 
-		for(u32 i = 0; i < TxnInst->NumCmds; i++) {
-			XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
-			//TBD handle custom OP as well
-			if((Cmd->Opcode == XAIE_IO_BLOCKWRITE || Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) &&
-					((void *)(uintptr_t)Cmd->DataPtr != NULL)) {
-				free((void *)(uintptr_t)Cmd->DataPtr);
-			}
-		}
+	RC = DevInst->Backend->Ops.CmdWrite(DevInst->IOInst, Col, Row, Command,
+			CmdWd0, CmdWd1, CmdStr);
+	_XAie_SyncRelease(DevInst, Token);
 
-		NodePtr = NodePtr->Next;
-		free(TxnInst->CmdBuf);
-		free(TxnInst);
-	}
+	return RC;
 }
 
 AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
@@ -1239,14 +2647,20 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Mask writing "
 					"to register\n");
-			return Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value);
+			return _XAie_IOWrite32(DevInst, RegOff, Value);
+		}
+
+		if((TxnInst->Flags & XAIE_TXN_COALESCING_MASK) &&
+				_XAie_TxnCoalesceWrite(DevInst, TxnInst, RegOff,
+					&Value, 1U)) {
+			return XAIE_OK;
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -1264,48 +2678,88 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value);
+	return _XAie_IOWrite32(DevInst, RegOff, Value);
 }
 
-AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
+/*****************************************************************************/
+/**
+* This API prepares a register read issued while transactions are recorded. The
+* commands recorded by the calling thread are flushed first if its transaction
+* auto flushes, so that the read observes them.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       XAIE_OK if the registers can be read, error code if the flush
+*		fails or if commands are pending in a transaction without auto
+*		flush.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnPrepareRead(XAie_DevInst *DevInst)
 {
-	u64 Tid;
 	AieRC RC;
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
-		Tid = Backend->Ops.GetTid();
-		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
-		if(TxnInst == NULL) {
-			XAIE_DBG("Could not find transaction instance "
-					"associated with thread. Reading "
-					"from register\n");
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
-		}
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) == NULL) {
+		return XAIE_OK;
+	}
 
-		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
-				(TxnInst->NumCmds > 0)) {
-			/* Flush command buffer */
-			XAIE_DBG("Auto flushing contents of the transaction "
-					"buffer.\n");
-			RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Failed to flush cmd buffer\n");
-				return RC;
-			}
+	TxnInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+	if(TxnInst == NULL) {
+		XAIE_DBG("Could not find transaction instance "
+				"associated with thread. Reading "
+				"from register\n");
+		return XAIE_OK;
+	}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
-		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
-		} else {
-			XAIE_ERROR("Read operation is not supported "
-					"when auto flush is disabled\n");
-			return XAIE_ERR;
-		}
+	if(TxnInst->NumCmds == 0) {
+		return XAIE_OK;
+	}
+
+	if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) == 0U) {
+		XAIE_ERROR("Read operation is not supported "
+				"when auto flush is disabled\n");
+		return XAIE_ERR;
+	}
+
+	/* Flush command buffer */
+	XAIE_DBG("Auto flushing contents of the transaction buffer.\n");
+	RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to flush cmd buffer\n");
+		return RC;
+	}
+
+	_XAie_TxnResetCmdBuf(TxnInst);
+
+	return XAIE_OK;
+}
+
+AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
+{
+	AieRC RC;
+
+	RC = _XAie_TxnPrepareRead(DevInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return _XAie_IORead32(DevInst, RegOff, Data);
+}
+
+AieRC XAie_BlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	AieRC RC;
+
+	RC = _XAie_TxnPrepareRead(DevInst);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
-	return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+
+	return _XAie_IOBlockRead32(DevInst, RegOff, Data, Size);
 }
 
 AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
@@ -1315,17 +2769,23 @@ AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Writing "
 					"to register\n");
-			return Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
+			return _XAie_IOMaskWrite32(DevInst, RegOff, Mask,
 					Value);
 		}
 
+		if((TxnInst->Flags & XAIE_TXN_COALESCING_MASK) &&
+				_XAie_TxnCoalesceMaskWrite(TxnInst, RegOff,
+					Mask, Value)) {
+			return XAIE_OK;
+		}
+
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
 			RC = _XAie_ReallocCmdBuf(TxnInst);
 			if (RC != XAIE_OK) {
@@ -1341,7 +2801,7 @@ AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
+	return _XAie_IOMaskWrite32(DevInst, RegOff, Mask,
 			Value);
 }
 
@@ -1353,15 +2813,15 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Polling "
 					"from register\n");
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+			return _XAie_IOMaskPoll(DevInst, RegOff, Mask, Value,
+					TimeOutUs);
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -1375,12 +2835,12 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 				return RC;
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_IOMaskPoll(DevInst, RegOff, Mask, Value,
+					TimeOutUs);
 		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+			return _XAie_IOMaskPoll(DevInst, RegOff, Mask, Value,
+					TimeOutUs);
 		} else {
 			if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
 				RC = _XAie_ReallocCmdBuf(TxnInst);
@@ -1393,13 +2853,13 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 			TxnInst->CmdBuf[TxnInst->NumCmds].RegOff = RegOff;
 			TxnInst->CmdBuf[TxnInst->NumCmds].Mask = Mask;
 			TxnInst->CmdBuf[TxnInst->NumCmds].Value = Value;
+			TxnInst->CmdBuf[TxnInst->NumCmds].Size = 0U;
 			TxnInst->NumCmds++;
 
 			return XAIE_OK;
 		}
 	}
-	return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-			Value, TimeOutUs);
+	return _XAie_IOMaskPoll(DevInst, RegOff, Mask, Value, TimeOutUs);
 }
 
 AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32 Size)
@@ -1410,14 +2870,14 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Block write "
 					"to register\n");
-			return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+			return _XAie_IOBlockWrite32(DevInst, RegOff,
 					Data, Size);
 		}
 
@@ -1433,11 +2893,17 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 				}
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_IOBlockWrite32(DevInst, RegOff,
 					Data, Size);
 		}
 
+		if((TxnInst->Flags & XAIE_TXN_COALESCING_MASK) && (Size > 0U) &&
+				_XAie_TxnCoalesceWrite(DevInst, TxnInst, RegOff,
+					Data, Size)) {
+			return XAIE_OK;
+		}
+
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
 			RC = _XAie_ReallocCmdBuf(TxnInst);
 			if (RC != XAIE_OK) {
@@ -1445,7 +2911,7 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 			}
 		}
 
-		Buf = (u32 *)malloc(sizeof(u32) * Size);
+		Buf = (u32 *)_XAie_TxnArenaAlloc(TxnInst, sizeof(u32) * Size);
 		if(Buf == NULL) {
 			XAIE_ERROR("Memory allocation for block write failed\n");
 			return XAIE_ERR;
@@ -1461,7 +2927,7 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+	return _XAie_IOBlockWrite32(DevInst, RegOff,
 			Data, Size);
 }
 
@@ -1472,14 +2938,14 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Block set "
 					"to register\n");
-			return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+			return _XAie_IOBlockSet32(DevInst, RegOff, Data,
 					Size);
 		}
 
@@ -1495,8 +2961,8 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 				}
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_IOBlockSet32(DevInst, RegOff, Data,
 					Size);
 		}
 
@@ -1516,7 +2982,7 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+	return _XAie_IOBlockSet32(DevInst, RegOff, Data,
 			Size);
 }
 
@@ -1528,15 +2994,15 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Writing cmd "
 					"to register\n");
-			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
-					Command, CmdWd0, CmdWd1, CmdStr);
+			return _XAie_IOCmdWrite(DevInst, Col, Row, Command,
+					CmdWd0, CmdWd1, CmdStr);
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -1550,20 +3016,49 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 				return RC;
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
-					Command, CmdWd0, CmdWd1, CmdStr);
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_IOCmdWrite(DevInst, Col, Row, Command,
+					CmdWd0, CmdWd1, CmdStr);
 		} else if(TxnInst->NumCmds == 0U) {
-			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
-					Command, CmdWd0, CmdWd1, CmdStr);
+			return _XAie_IOCmdWrite(DevInst, Col, Row, Command,
+					CmdWd0, CmdWd1, CmdStr);
 		} else {
 			XAIE_ERROR("Cmd Write operation is not supported "
 					"when auto flush is disabled\n");
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
-			Command, CmdWd0, CmdWd1, CmdStr);
+	return _XAie_IOCmdWrite(DevInst, Col, Row, Command, CmdWd0,
+			CmdWd1, CmdStr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api runs a backend operation and drops the shadow register cache values
+* which may have been changed by it.
+*
+* @param	DevInst: Device instance pointer
+* @param	Op: Backend operation code
+* @param	Arg: Argument of the backend operation
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_IORunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op,
+		void *Arg)
+{
+	AieRC RC;
+	u32 Token;
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	RC = DevInst->Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+	_XAie_ShadowInvalidateForOp(DevInst, Op, Arg);
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
 }
 
 AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
@@ -1574,13 +3069,13 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Running Op.\n");
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			return _XAie_IORunOp(DevInst, Op, Arg);
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -1592,10 +3087,10 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 				return RC;
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_IORunOp(DevInst, Op, Arg);
 		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			return _XAie_IORunOp(DevInst, Op, Arg);
 		} else if(Op == XAIE_BACKEND_OP_CONFIG_SHIMDMABD) {
 			XAie_ShimDmaBdArgs *BdArgs =
 				(XAie_ShimDmaBdArgs *)Arg;
@@ -1638,7 +3133,7 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+	return _XAie_IORunOp(DevInst, Op, Arg);
 }
 
 AieRC _XAie_ClearTransaction(XAie_DevInst* DevInst)
@@ -1654,19 +3149,12 @@ AieRC _XAie_ClearTransaction(XAie_DevInst* DevInst)
 		return XAIE_ERR;
 	}
 
-	for(u32 i = 0U; i < Inst->NumCmds; i++) {
-		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
-		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE || Cmd->Opcode >= XAIE_IO_CUSTOM_OP_BEGIN) {
-			XAIE_DBG("free DataPtr %p\n", Cmd->DataPtr);
-			free((void *)Cmd->DataPtr);
-		}
-	}
-
-	RC = _XAie_RemoveTxnInstFromList(DevInst, Backend->Ops.GetTid());
+	RC = _XAie_RemoveTxnInstFromList(DevInst, Inst);
 	if(RC != XAIE_OK) {
 		return RC;
 	}
 
+	_XAie_TxnArenaFree(Inst);
 	free(Inst->CmdBuf);
 	free(Inst);
 
@@ -1730,7 +3218,7 @@ AieRC XAie_AddCustomTxnOp(XAie_DevInst *DevInst, u8 OpNumber, void* Args, size_t
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(XAIE_ATOMIC_LOAD(&DevInst->TxnList.Next) != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
@@ -1746,7 +3234,7 @@ AieRC XAie_AddCustomTxnOp(XAie_DevInst *DevInst, u8 OpNumber, void* Args, size_t
 		}
 
 		/* check memory allocation before increase Cmd vector */
-		char* tmpBuff = malloc(size);
+		char* tmpBuff = _XAie_TxnArenaAlloc(TxnInst, size);
 		if(!tmpBuff) {
 			XAIE_DBG("Fail to malloc %d size memory for DataPtr\n", size);
 			return XAIE_ERR;
@@ -1776,5 +3264,234 @@ AieRC XAie_AddCustomTxnOp(XAie_DevInst *DevInst, u8 OpNumber, void* Args, size_t
 	return XAIE_ERR;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API binds a host handler to a custom operation code. The handler is
+* called with the arguments of the operation whenever it is executed by the
+* driver, when a transaction is flushed or when a serialized transaction is
+* replayed.
+*
+* @param    DevInst - Global AIE device instance pointer.
+* @param    OpNumber - Custom operation code.
+* @param    Handler - Handler of the operation, NULL to remove the handler.
+* @param    Priv - Private data passed to the handler.
+*
+* @return   XAIE_OK for success and error code otherwise.
+*
+* @note     Custom operations without a handler are skipped.
+*
+******************************************************************************/
+AieRC XAie_RegisterCustomTxnOpHandler(XAie_DevInst *DevInst, u8 OpNumber,
+		XAie_TxnCustomOpHandler Handler, void *Priv)
+{
+	XAie_TxnCustomOp *Op;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(OpNumber < XAIE_IO_CUSTOM_OP_BEGIN) {
+		XAIE_ERROR("Invalid Op Code %d\n", OpNumber);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->TxnCustomOps == NULL) {
+		if(Handler == NULL) {
+			return XAIE_OK;
+		}
+
+		DevInst->TxnCustomOps = (XAie_TxnCustomOp *)calloc(
+				XAIE_IO_CUSTOM_OP_MAX - XAIE_IO_CUSTOM_OP_BEGIN + 1,
+				sizeof(*DevInst->TxnCustomOps));
+		if(DevInst->TxnCustomOps == NULL) {
+			XAIE_ERROR("Failed to allocate memory for custom op "
+					"handlers\n");
+			return XAIE_ERR;
+		}
+	}
+
+	Op = &DevInst->TxnCustomOps[OpNumber - XAIE_IO_CUSTOM_OP_BEGIN];
+	Op->Handler = Handler;
+	Op->Priv = Priv;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the custom operation handlers of the device instance.
+*
+* @param    DevInst - Global AIE device instance pointer.
+*
+* @return   None.
+*
+* @note     Internal only.
+*
+******************************************************************************/
+void _XAie_TxnCustomOpsFree(XAie_DevInst *DevInst)
+{
+	free(DevInst->TxnCustomOps);
+	DevInst->TxnCustomOps = NULL;
+}
+
+#ifdef __linux__
+static inline u64 _XAie_PollNowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000U + (u64)Ts.tv_nsec / 1000U;
+}
+
+static inline void _XAie_PollSleepUs(u32 Us)
+{
+	struct timespec Ts;
+
+	Ts.tv_sec = Us / 1000000U;
+	Ts.tv_nsec = (long)(Us % 1000000U) * 1000L;
+	nanosleep(&Ts, NULL);
+}
+#else
+/*
+ * No monotonic clock is available, the elapsed time is estimated from the
+ * requested sleeps and each check is accounted as 1us.
+ */
+static inline void _XAie_PollSleepUs(u32 Us)
+{
+#ifdef __AIEBAREMETAL__
+	usleep(Us);
+#else
+	(void)Us;
+#endif
+}
+#endif /* __linux__ */
+
+/*****************************************************************************/
+/**
+*
+* This API records the latency of a completed poll.
+*
+* @param	Stats: Poll statistics to update.
+* @param	ElapsedUs: Duration of the poll in micro seconds.
+* @param	NumChecks: Number of times the condition was checked.
+* @param	RC: Status of the poll.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_PollUpdateStats(XAie_PollStats *Stats, u64 ElapsedUs,
+		u32 NumChecks, AieRC RC)
+{
+	u32 Bucket = 0U;
+
+	while((Bucket < XAIE_POLL_STATS_NUM_BUCKETS - 1U) &&
+			(ElapsedUs >= (1ULL << Bucket))) {
+		Bucket++;
+	}
+
+	/* Polls of different columns may complete concurrently */
+	XAIE_ATOMIC_ADD(&Stats->NumPolls, 1U);
+	XAIE_ATOMIC_ADD(&Stats->NumReads, NumChecks);
+	XAIE_ATOMIC_STORE(&Stats->LastUs, ElapsedUs);
+	XAIE_ATOMIC_ADD(&Stats->TotalUs, ElapsedUs);
+	XAIE_ATOMIC_MAX(&Stats->MaxUs, ElapsedUs);
+	if(RC == XAIE_TIMEOUT) {
+		XAIE_ATOMIC_ADD(&Stats->NumTimeouts, 1U);
+	}
+	XAIE_ATOMIC_ADD(&Stats->Histogram[Bucket], 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API polls a condition until it is met or the timeout expires. This is
+* the poll loop of the driver, used for register polls of the backends as well
+* as for conditions evaluated by the driver, such as the status of several DMA
+* channels or cores. The condition is checked back to back for the spin period
+* of the poll configuration, then the poll sleeps between the checks with the
+* sleep period doubling from the minimum to the maximum backoff. Completions
+* shorter than the spin period are detected without any sleep.
+*
+* @param    Poll - Poll configuration and statistics of the device instance.
+*           If NULL, the default configuration is used and no statistics are
+*           recorded.
+* @param    Check - Function evaluating the condition.
+* @param    Priv - Argument passed to the check function.
+* @param    TimeOutUs - Timeout in micro seconds. The condition is checked at
+*           least once.
+*
+* @return   XAIE_OK if the condition is met, XAIE_TIMEOUT on timeout, the
+*           error code of the check function if it fails.
+*
+* @note     Internal only. Each check is counted as one read in the poll
+*           statistics.
+*
+******************************************************************************/
+AieRC _XAie_PollCondition(XAie_PollCtx *Poll, XAie_PollCheck Check,
+		void *Priv, u32 TimeOutUs)
+{
+	AieRC RC;
+	u8 Done = 0U;
+	u32 SpinUs, SleepUs, MaxSleepUs, NumChecks = 0U;
+	u64 ElapsedUs = 0U;
+#ifdef __linux__
+	u64 StartUs = _XAie_PollNowUs();
+#endif
+
+	if(Poll != NULL) {
+		SpinUs = XAIE_ATOMIC_LOAD(&Poll->Config.SpinUs);
+		SleepUs = XAIE_ATOMIC_LOAD(&Poll->Config.BackoffMinUs);
+		MaxSleepUs = XAIE_ATOMIC_LOAD(&Poll->Config.BackoffMaxUs);
+	} else {
+		SpinUs = XAIE_POLL_DEFAULT_SPIN_US;
+		SleepUs = XAIE_POLL_DEFAULT_BACKOFF_MIN_US;
+		MaxSleepUs = XAIE_POLL_DEFAULT_BACKOFF_MAX_US;
+	}
+
+	while(1) {
+		RC = Check(Priv, &Done);
+		NumChecks++;
+#ifdef __linux__
+		ElapsedUs = _XAie_PollNowUs() - StartUs;
+#else
+		ElapsedUs++;
+#endif
+		if((RC != XAIE_OK) || (Done != 0U)) {
+			break;
+		}
+
+		if(ElapsedUs >= TimeOutUs) {
+			RC = XAIE_TIMEOUT;
+			break;
+		}
+
+		if(ElapsedUs < SpinUs) {
+			continue;
+		}
+
+		if((u64)SleepUs > TimeOutUs - ElapsedUs) {
+			_XAie_PollSleepUs((u32)(TimeOutUs - ElapsedUs));
+		} else {
+			_XAie_PollSleepUs(SleepUs);
+		}
+#ifndef __linux__
+		ElapsedUs += SleepUs;
+#endif
+		SleepUs = (SleepUs < MaxSleepUs / 2U) ? SleepUs * 2U :
+			MaxSleepUs;
+	}
+
+	if(Poll != NULL) {
+		_XAie_PollUpdateStats(&Poll->Stats, ElapsedUs, NumChecks, RC);
+	}
+
+	return RC;
+}
 
 /** @} */
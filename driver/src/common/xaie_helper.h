@@ -92,6 +92,33 @@
 #else
 #define XAIE_PACK_ATTRIBUTE  __attribute__((packed, aligned(4)))
 #endif
+
+/*
+ * Relaxed atomic accesses of fields shared by the threads using a device
+ * instance. Plain accesses are used where the builtins are not available.
+ */
+#ifdef _MSC_VER
+#define XAIE_ATOMIC_ADD(Ptr, Val)	(*(Ptr) += (Val))
+#define XAIE_ATOMIC_LOAD(Ptr)		(*(Ptr))
+#define XAIE_ATOMIC_STORE(Ptr, Val)	(*(Ptr) = (Val))
+#define XAIE_ATOMIC_MAX(Ptr, Val)	\
+	do { if((Val) > *(Ptr)) { *(Ptr) = (Val); } } while(0)
+#else
+#define XAIE_ATOMIC_ADD(Ptr, Val)	\
+	__atomic_fetch_add((Ptr), (Val), __ATOMIC_RELAXED)
+#define XAIE_ATOMIC_LOAD(Ptr)		\
+	__atomic_load_n((Ptr), __ATOMIC_RELAXED)
+#define XAIE_ATOMIC_STORE(Ptr, Val)	\
+	__atomic_store_n((Ptr), (Val), __ATOMIC_RELAXED)
+#define XAIE_ATOMIC_MAX(Ptr, Val)					      \
+	do {								      \
+		__typeof__(*(Ptr)) _Old = __atomic_load_n((Ptr),	      \
+				__ATOMIC_RELAXED);			      \
+		while(((Val) > _Old) &&					      \
+			!__atomic_compare_exchange_n((Ptr), &_Old, (Val), 1,  \
+				__ATOMIC_RELAXED, __ATOMIC_RELAXED));	      \
+	} while(0)
+#endif
 /**************************** Type Definitions *******************************/
 typedef enum {
 	XAIE_IO_WRITE,
@@ -114,6 +141,41 @@ struct XAie_TxnCmd {
 	u32 Size;
 };
 
+/*
+ * Block of the bump allocator backing the payloads of a transaction instance.
+ * Blocks are linked from the most recently allocated one.
+ */
+struct XAie_TxnArena {
+	struct XAie_TxnArena *Next;
+	u32 Size;	/* Number of bytes available in Data */
+	u32 Used;	/* Number of bytes allocated from Data */
+	u64 Data[];
+};
+
+/*
+ * Field of a command in an exported transaction instance which is rewritten
+ * by XAie_TxnPatch() before the instance is submitted.
+ */
+struct XAie_TxnPatchPoint {
+	u32 CmdIdx;	/* Index of the command in the command buffer */
+	u32 WordIdx;	/* Payload word of block writes, 0 otherwise */
+	u32 Mask;	/* Bits of the register owned by the field */
+	u8 Lsb;		/* Lowest bit of the field */
+	u8 Shift;	/* Right shift applied to the patch value */
+};
+
+/* Host handler bound to a custom transaction operation code */
+struct XAie_TxnCustomOp {
+	XAie_TxnCustomOpHandler Handler;
+	void *Priv;
+};
+
+/*
+ * Condition polled by _XAie_PollCondition(). Sets Done once the condition is
+ * met, returns an error code to stop the poll.
+ */
+typedef AieRC (*XAie_PollCheck)(void *Priv, u8 *Done);
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -134,6 +196,43 @@ static inline u64 _XAie_GetTileAddr(XAie_DevInst *DevInst, u8 R, u8 C)
 		(((u64)C & 0xFF) << DevInst->DevProp.ColShift);
 }
 
+/*****************************************************************************/
+/**
+*
+* Calculates the partition relative column of a register offset
+*
+* @param	DevInst: Device Instance
+* @param	RegOff: Partition relative register offset
+* @return	Column of the tile the register belongs to
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u8 _XAie_GetColfromRegOff(XAie_DevInst *DevInst, u64 RegOff)
+{
+	return (u8)(RegOff >> DevInst->DevProp.ColShift);
+}
+
+/*****************************************************************************/
+/**
+*
+* Calculates the row of a register offset
+*
+* @param	DevInst: Device Instance
+* @param	RegOff: Partition relative register offset
+* @return	Row of the tile the register belongs to
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u8 _XAie_GetRowfromRegOff(XAie_DevInst *DevInst, u64 RegOff)
+{
+	u64 Mask = (1ULL << (DevInst->DevProp.ColShift -
+				DevInst->DevProp.RowShift)) - 1U;
+
+	return (u8)((RegOff >> DevInst->DevProp.RowShift) & Mask);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -183,23 +282,40 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data,
 			u32 Size);
 AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size);
+AieRC XAie_BlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data,
+		u32 Size);
 AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 		u32 CmdWd0, u32 CmdWd1, const char *CmdStr);
 int BuffHexDump(char* buff,size_t size);
 int XAie_RequestCustomTxnOp(XAie_DevInst *DevInst);
 AieRC XAie_AddCustomTxnOp(XAie_DevInst *DevInst, u8 OpNumber, void* Args, size_t size);
+AieRC XAie_RegisterCustomTxnOpHandler(XAie_DevInst *DevInst, u8 OpNumber,
+		XAie_TxnCustomOpHandler Handler, void *Priv);
+void _XAie_TxnCustomOpsFree(XAie_DevInst *DevInst);
 AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg);
 AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags);
+AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd);
 AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
 XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst);
 u8* _XAie_TxnExportSerialized(XAie_DevInst *DevInst, u8 NumConsumers,
 		u32 Flags);
+AieRC _XAie_TxnExportSerializedToFd(XAie_DevInst *DevInst, int Fd,
+		u8 NumConsumers, u32 Flags);
 AieRC _XAie_ClearTransaction(XAie_DevInst* DevInst);
 AieRC _XAie_TxnFree(XAie_TxnInst *Inst);
+AieRC _XAie_TxnAddPatchPoint(XAie_TxnInst *TxnInst, u64 RegOff, u32 Mask,
+		u8 Shift, u32 *Slot);
+AieRC _XAie_TxnPatch(XAie_TxnInst *TxnInst, u32 Slot, u64 Value);
 void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst);
 u32 _XAie_GetNumRows(XAie_DevInst *DevInst, u8 TileType);
 u32 _XAie_GetStartRow(XAie_DevInst *DevInst, u8 TileType);
 void _XAie_FreeTxnPtr(void *Ptr);
+XAie_TxnInst* _XAie_TxnImportSerialized(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 BufSize);
+AieRC _XAie_TxnExecuteSerialized(XAie_DevInst *DevInst, const u8 *TxnPtr,
+		u32 BufSize);
+AieRC _XAie_PollCondition(XAie_PollCtx *Poll, XAie_PollCheck Check,
+		void *Priv, u32 TimeOutUs);
 
 #endif		/* end of protection macro */
 /** @} */
@@ -0,0 +1,1065 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_shadow.c
+* @{
+*
+* This file contains the shadow register cache of the device instance. The
+* cache remembers the last value written to the static configuration registers
+* of the partition so that redundant writes can be dropped and masked writes
+* can be served without a read-modify-write round trip.
+*
+* Only registers which are not modified by the hardware are cached. The
+* allow-list is derived from the tile module properties of the device and
+* covers the stream switch port and slot configuration, DMA buffer descriptors
+* and channel controls, event broadcast and group enables and the trace
+* control registers. Memories, counters, locks, status registers and any
+* register with side effects on write are never cached.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_helper.h"
+#include "xaie_shadow.h"
+#include "xaie_sync.h"
+#include "xaiegbl_regdef.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_SHADOW_INIT_CAPACITY	256U
+#define XAIE_SHADOW_MAX_RANGES		64U
+#define XAIE_SHADOW_HASH_MULTIPLIER	0x9E3779B97F4A7C15ULL
+
+#define XAIE_SHADOW_ENTRY_EMPTY		0U
+#define XAIE_SHADOW_ENTRY_VALID		1U
+#define XAIE_SHADOW_ENTRY_DELETED	2U
+
+/* Table is rehashed once valid and deleted entries reach 70% of capacity */
+#define XAIE_SHADOW_LOAD_NUM		7U
+#define XAIE_SHADOW_LOAD_DEN		10U
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This api returns the hash table slot of a register offset.
+*
+* @param	Cache: Shadow cache pointer
+* @param	RegOff: Partition relative register offset
+*
+* @return	Slot index within the hash table.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u32 _XAie_ShadowHash(const XAie_ShadowCache *Cache, u64 RegOff)
+{
+	return (u32)(((RegOff >> 2U) * XAIE_SHADOW_HASH_MULTIPLIER) >> 32U) &
+		(Cache->Capacity - 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api looks up the cached value of a register.
+*
+* @param	Cache: Shadow cache pointer
+* @param	RegOff: Partition relative register offset
+*
+* @return	Pointer to the valid entry of the register or NULL if the value of
+*		the register is not known.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static XAie_ShadowEntry *_XAie_ShadowLookup(XAie_ShadowCache *Cache, u64 RegOff)
+{
+	u32 Idx = _XAie_ShadowHash(Cache, RegOff);
+
+	for(u32 i = 0U; i < Cache->Capacity; i++) {
+		XAie_ShadowEntry *Entry = &Cache->Entries[Idx];
+
+		if(Entry->State == XAIE_SHADOW_ENTRY_EMPTY) {
+			return NULL;
+		}
+
+		if((Entry->State == XAIE_SHADOW_ENTRY_VALID) &&
+				(Entry->RegOff == RegOff)) {
+			return Entry;
+		}
+
+		Idx = (Idx + 1U) & (Cache->Capacity - 1U);
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api places a register value in the first free slot of its probe
+* sequence. The register must not already be present in the table and the
+* table must have at least one free slot.
+*
+* @param	Cache: Shadow cache pointer
+* @param	RegOff: Partition relative register offset
+* @param	Value: Register value
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_ShadowPlace(XAie_ShadowCache *Cache, u64 RegOff, u32 Value)
+{
+	u32 Idx = _XAie_ShadowHash(Cache, RegOff);
+	XAie_ShadowEntry *Entry = &Cache->Entries[Idx];
+
+	while(Entry->State == XAIE_SHADOW_ENTRY_VALID) {
+		Idx = (Idx + 1U) & (Cache->Capacity - 1U);
+		Entry = &Cache->Entries[Idx];
+	}
+
+	if(Entry->State == XAIE_SHADOW_ENTRY_EMPTY) {
+		Cache->NumUsed++;
+	}
+
+	Entry->RegOff = RegOff;
+	Entry->Value = Value;
+	Entry->State = XAIE_SHADOW_ENTRY_VALID;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api rebuilds the hash table to drop deleted entries. The table is
+* doubled if more than half of it is occupied by valid entries.
+*
+* @param	Cache: Shadow cache pointer
+*
+* @return	XAIE_OK on success and XAIE_ERR if the new table could not be
+*		allocated. The old table is left untouched on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ShadowRehash(XAie_ShadowCache *Cache)
+{
+	XAie_ShadowEntry *Old = Cache->Entries;
+	u32 OldCapacity = Cache->Capacity;
+	u32 NumValid = 0U, Capacity = OldCapacity;
+
+	for(u32 i = 0U; i < OldCapacity; i++) {
+		if(Old[i].State == XAIE_SHADOW_ENTRY_VALID) {
+			NumValid++;
+		}
+	}
+
+	if((NumValid + 1U) * 2U > Capacity) {
+		Capacity *= 2U;
+	}
+
+	Cache->Entries = (XAie_ShadowEntry *)calloc(Capacity, sizeof(*Old));
+	if(Cache->Entries == NULL) {
+		Cache->Entries = Old;
+		return XAIE_ERR;
+	}
+
+	Cache->Capacity = Capacity;
+	Cache->NumUsed = 0U;
+	for(u32 i = 0U; i < OldCapacity; i++) {
+		if(Old[i].State == XAIE_SHADOW_ENTRY_VALID) {
+			_XAie_ShadowPlace(Cache, Old[i].RegOff, Old[i].Value);
+		}
+	}
+
+	free(Old);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api records the value of a register which is not present in the cache.
+*
+* @param	Cache: Shadow cache pointer
+* @param	RegOff: Partition relative register offset
+* @param	Value: Register value
+*
+* @return	None.
+*
+* @note		Internal only. If the table cannot grow, the register is left
+*		uncached which is always safe.
+*
+******************************************************************************/
+static void _XAie_ShadowInsert(XAie_ShadowCache *Cache, u64 RegOff, u32 Value)
+{
+	if((Cache->NumUsed + 1U) * XAIE_SHADOW_LOAD_DEN >
+			Cache->Capacity * XAIE_SHADOW_LOAD_NUM) {
+		if(_XAie_ShadowRehash(Cache) != XAIE_OK) {
+			XAIE_DBG("Failed to grow shadow cache, register 0x%lx "
+					"is not cached\n", RegOff);
+			return;
+		}
+	}
+
+	_XAie_ShadowPlace(Cache, RegOff, Value);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api updates or records the value of a register.
+*
+* @param	Cache: Shadow cache pointer
+* @param	Entry: Existing entry of the register or NULL
+* @param	RegOff: Partition relative register offset
+* @param	Value: Register value
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline void _XAie_ShadowStore(XAie_ShadowCache *Cache,
+		XAie_ShadowEntry *Entry, u64 RegOff, u32 Value)
+{
+	if(Entry != NULL) {
+		Entry->Value = Value;
+	} else {
+		_XAie_ShadowInsert(Cache, RegOff, Value);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This api forgets the value of a register.
+*
+* @param	Cache: Shadow cache pointer
+* @param	RegOff: Partition relative register offset
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_ShadowDelete(XAie_ShadowCache *Cache, u64 RegOff)
+{
+	XAie_ShadowEntry *Entry = _XAie_ShadowLookup(Cache, RegOff);
+
+	if(Entry != NULL) {
+		Entry->State = XAIE_SHADOW_ENTRY_DELETED;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This api adds a tile relative register range to the allow-list being built.
+*
+* @param	Ranges: Array of ranges
+* @param	NumRanges: Pointer to the number of ranges in the array
+* @param	Start: Tile relative offset of the first register
+* @param	Size: Size of the range in bytes
+*
+* @return	XAIE_OK on success and XAIE_ERR if the array is full.
+*
+* @note		Internal only. Empty ranges are ignored.
+*
+******************************************************************************/
+static AieRC _XAie_ShadowAddRange(XAie_ShadowRange *Ranges, u32 *NumRanges,
+		u32 Start, u32 Size)
+{
+	if(Size == 0U) {
+		return XAIE_OK;
+	}
+
+	if(*NumRanges == XAIE_SHADOW_MAX_RANGES) {
+		XAIE_ERROR("Too many shadow cache ranges\n");
+		return XAIE_ERR;
+	}
+
+	Ranges[*NumRanges].Start = Start;
+	Ranges[*NumRanges].End = Start + Size;
+	(*NumRanges)++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api builds the sorted allow-list of cacheable registers of a tile type
+* from its module properties.
+*
+* @param	DevInst: Device instance pointer
+* @param	Cache: Shadow cache pointer
+* @param	TileType: Type of the tile
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ShadowBuildRanges(XAie_DevInst *DevInst,
+		XAie_ShadowCache *Cache, u8 TileType)
+{
+	AieRC RC = XAIE_OK;
+	XAie_ShadowRange Ranges[XAIE_SHADOW_MAX_RANGES];
+	u32 NumRanges = 0U, NumMerged = 0U;
+	const XAie_TileMod *TileMod = &DevInst->DevProp.DevMod[TileType];
+	const XAie_StrmMod *StrmMod = TileMod->StrmSw;
+	const XAie_DmaMod *DmaMod = TileMod->DmaMod;
+
+	if(StrmMod != NULL) {
+		u32 SlotBase = UINT_MAX;
+
+		RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+				StrmMod->MstrConfigBaseAddr,
+				(StrmMod->MaxMasterPhyPortId + 1U) *
+				StrmMod->PortOffset);
+		RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+				StrmMod->SlvConfigBaseAddr,
+				(StrmMod->MaxSlavePhyPortId + 1U) *
+				StrmMod->PortOffset);
+
+		for(u32 i = 0U; i < SS_PORT_TYPE_MAX; i++) {
+			if((StrmMod->SlvSlotConfig[i].NumPorts != 0U) &&
+				(StrmMod->SlvSlotConfig[i].PortBaseAddr <
+				 SlotBase)) {
+				SlotBase = StrmMod->SlvSlotConfig[i].PortBaseAddr;
+			}
+		}
+
+		if(SlotBase != UINT_MAX) {
+			RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+					SlotBase,
+					(StrmMod->MaxSlavePhyPortId + 1U) *
+					StrmMod->SlotOffsetPerPort);
+		}
+	}
+
+	if(DmaMod != NULL) {
+		RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+				DmaMod->BaseAddr,
+				DmaMod->NumBds * DmaMod->IdxOffset);
+
+		/*
+		 * Channel controls are added one by one as the start queue
+		 * registers are interleaved with them on some devices.
+		 */
+		for(u32 Dir = 0U; Dir < DMA_MAX; Dir++) {
+			for(u32 Ch = 0U; Ch < DmaMod->NumChannels; Ch++) {
+				RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+						DmaMod->ChCtrlBase +
+						Ch * DmaMod->ChIdxOffset +
+						Dir * DmaMod->ChIdxOffset *
+						DmaMod->NumChannels, 4U);
+			}
+		}
+	}
+
+	for(u32 Module = 0U; Module < TileMod->NumModules; Module++) {
+		if(TileMod->EvntMod != NULL) {
+			const XAie_EvntMod *EvntMod = &TileMod->EvntMod[Module];
+
+			RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+					EvntMod->BaseBroadcastRegOff,
+					EvntMod->NumBroadcastIds * 4U);
+			RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+					EvntMod->BaseGroupEventRegOff,
+					EvntMod->NumGroupEvents * 4U);
+		}
+
+		if(TileMod->TraceMod != NULL) {
+			const XAie_TraceMod *TraceMod =
+				&TileMod->TraceMod[Module];
+
+			RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+					TraceMod->CtrlRegOff, 4U);
+			RC |= _XAie_ShadowAddRange(Ranges, &NumRanges,
+					TraceMod->PktConfigRegOff, 4U);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	if(NumRanges == 0U) {
+		return XAIE_OK;
+	}
+
+	/* Sort by start offset and merge overlapping or adjacent ranges */
+	for(u32 i = 1U; i < NumRanges; i++) {
+		XAie_ShadowRange Range = Ranges[i];
+		u32 j = i;
+
+		while((j > 0U) && (Ranges[j - 1U].Start > Range.Start)) {
+			Ranges[j] = Ranges[j - 1U];
+			j--;
+		}
+		Ranges[j] = Range;
+	}
+
+	for(u32 i = 1U; i < NumRanges; i++) {
+		if(Ranges[i].Start <= Ranges[NumMerged].End) {
+			if(Ranges[i].End > Ranges[NumMerged].End) {
+				Ranges[NumMerged].End = Ranges[i].End;
+			}
+		} else {
+			Ranges[++NumMerged] = Ranges[i];
+		}
+	}
+	NumMerged++;
+
+	Cache->Ranges[TileType] = (XAie_ShadowRange *)malloc(NumMerged *
+			sizeof(*Ranges));
+	if(Cache->Ranges[TileType] == NULL) {
+		XAIE_ERROR("Memory allocation for shadow cache failed\n");
+		return XAIE_ERR;
+	}
+
+	memcpy(Cache->Ranges[TileType], Ranges, NumMerged * sizeof(*Ranges));
+	Cache->NumRanges[TileType] = NumMerged;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api finds the allow-list of the tile addressed by a register offset and
+* the first range which ends after the register.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative register offset
+* @param	TileType: Pointer to store the type of the tile
+* @param	Idx: Pointer to store the index of the range
+*
+* @return	Tile relative offset of the register.
+*
+* @note		Internal only. TileType is set to XAIEGBL_TILE_TYPE_MAX if
+*		the offset is outside of the partition.
+*
+******************************************************************************/
+static u32 _XAie_ShadowFindRange(XAie_DevInst *DevInst, u64 RegOff,
+		u8 *TileType, u32 *Idx)
+{
+	const XAie_ShadowCache *Cache = DevInst->ShadowCache;
+	const XAie_ShadowRange *Ranges;
+	u8 RowShift = DevInst->DevProp.RowShift;
+	u8 ColShift = DevInst->DevProp.ColShift;
+	u64 Col = RegOff >> ColShift;
+	u64 Row = (RegOff >> RowShift) & ((1U << (ColShift - RowShift)) - 1U);
+	u32 TileOff = (u32)(RegOff & ((1U << RowShift) - 1U));
+	u32 Low = 0U, High;
+
+	*TileType = XAIEGBL_TILE_TYPE_MAX;
+	*Idx = 0U;
+	if((Col >= DevInst->NumCols) || (Row >= DevInst->NumRows)) {
+		return TileOff;
+	}
+
+	*TileType = DevInst->DevOps->GetTTypefromLoc(DevInst,
+			XAie_TileLoc((u8)Col, (u8)Row));
+	if(*TileType >= XAIEGBL_TILE_TYPE_MAX) {
+		return TileOff;
+	}
+
+	Ranges = Cache->Ranges[*TileType];
+	High = Cache->NumRanges[*TileType];
+	while(Low < High) {
+		u32 Mid = Low + (High - Low) / 2U;
+
+		if(Ranges[Mid].End <= TileOff) {
+			Low = Mid + 1U;
+		} else {
+			High = Mid;
+		}
+	}
+
+	*Idx = Low;
+
+	return TileOff;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks if a tile relative offset is covered by the allow-list. The
+* range index is advanced as the offsets are expected in increasing order.
+*
+* @param	Cache: Shadow cache pointer
+* @param	TileType: Type of the tile
+* @param	Idx: Pointer to the index of the current range
+* @param	TileOff: Tile relative register offset
+*
+* @return	XAIE_ENABLE if the register is cacheable, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_ShadowInRange(const XAie_ShadowCache *Cache,
+		u8 TileType, u32 *Idx, u32 TileOff)
+{
+	const XAie_ShadowRange *Ranges;
+
+	if(TileType >= XAIEGBL_TILE_TYPE_MAX) {
+		return XAIE_DISABLE;
+	}
+
+	Ranges = Cache->Ranges[TileType];
+
+	while((*Idx < Cache->NumRanges[TileType]) &&
+			(Ranges[*Idx].End <= TileOff)) {
+		(*Idx)++;
+	}
+
+	return (*Idx < Cache->NumRanges[TileType]) &&
+		(Ranges[*Idx].Start <= TileOff);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks if a register can be served from the shadow cache.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative register offset
+*
+* @return	XAIE_ENABLE if the register is cacheable, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u8 _XAie_ShadowIsCacheable(XAie_DevInst *DevInst, u64 RegOff)
+{
+	u8 TileType;
+	u32 Idx, TileOff;
+
+	TileOff = _XAie_ShadowFindRange(DevInst, RegOff, &TileType, &Idx);
+
+	return _XAie_ShadowInRange(DevInst->ShadowCache, TileType, &Idx,
+			TileOff);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks if a register is a static configuration register, which has
+* no side effects on write and is not modified by the hardware. The check uses
+* the allow-list of the shadow cache.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative register offset
+*
+* @return	XAIE_ENABLE if the register is a static configuration register,
+*		XAIE_DISABLE if it is not or the shadow cache is disabled.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+u8 _XAie_ShadowIsStaticReg(XAie_DevInst *DevInst, u64 RegOff)
+{
+	if(DevInst->ShadowCache == NULL) {
+		return XAIE_DISABLE;
+	}
+
+	return _XAie_ShadowIsCacheable(DevInst, RegOff);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks if the current backend returns the register values on read.
+*
+* @param	DevInst: Device instance pointer
+*
+* @return	XAIE_ENABLE if registers can be read back, XAIE_DISABLE
+*		otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_ShadowCanReadBack(XAie_DevInst *DevInst)
+{
+	return (DevInst->Backend->Type != XAIE_IO_BACKEND_CDO) &&
+		(DevInst->Backend->Type != XAIE_IO_BACKEND_DEBUG);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api allocates the shadow cache of the device instance and builds the
+* allow-list of cacheable registers for every tile type.
+*
+* @param	DevInst: Device instance pointer
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. Enabling an enabled cache is a no-op.
+*
+******************************************************************************/
+AieRC _XAie_ShadowEnable(XAie_DevInst *DevInst)
+{
+	AieRC RC;
+	XAie_ShadowCache *Cache;
+
+	if(DevInst->ShadowCache != NULL) {
+		return XAIE_OK;
+	}
+
+	Cache = (XAie_ShadowCache *)calloc(1U, sizeof(*Cache));
+	if(Cache == NULL) {
+		XAIE_ERROR("Memory allocation for shadow cache failed\n");
+		return XAIE_ERR;
+	}
+
+	DevInst->ShadowCache = Cache;
+	Cache->Capacity = XAIE_SHADOW_INIT_CAPACITY;
+	Cache->Entries = (XAie_ShadowEntry *)calloc(Cache->Capacity,
+			sizeof(*Cache->Entries));
+	if(Cache->Entries == NULL) {
+		XAIE_ERROR("Memory allocation for shadow cache failed\n");
+		_XAie_ShadowFree(DevInst);
+		return XAIE_ERR;
+	}
+
+	for(u8 TileType = 0U; TileType < XAIEGBL_TILE_TYPE_MAX; TileType++) {
+		RC = _XAie_ShadowBuildRanges(DevInst, Cache, TileType);
+		if(RC != XAIE_OK) {
+			_XAie_ShadowFree(DevInst);
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api releases the shadow cache of the device instance.
+*
+* @param	DevInst: Device instance pointer
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_ShadowFree(XAie_DevInst *DevInst)
+{
+	XAie_ShadowCache *Cache = DevInst->ShadowCache;
+
+	if(Cache == NULL) {
+		return;
+	}
+
+	for(u8 TileType = 0U; TileType < XAIEGBL_TILE_TYPE_MAX; TileType++) {
+		free(Cache->Ranges[TileType]);
+	}
+
+	free(Cache->Entries);
+	free(Cache);
+	DevInst->ShadowCache = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api drops all the register values held by the shadow cache.
+*
+* @param	DevInst: Device instance pointer
+*
+* @return	None.
+*
+* @note		Internal only. It is called whenever the registers may have
+*		been changed without going through the cache.
+*
+******************************************************************************/
+void _XAie_ShadowInvalidate(XAie_DevInst *DevInst)
+{
+	XAie_ShadowCache *Cache = DevInst->ShadowCache;
+	u32 Token;
+
+	if(Cache == NULL) {
+		return;
+	}
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	if(Cache->NumUsed != 0U) {
+		memset(Cache->Entries, 0,
+				Cache->Capacity * sizeof(*Cache->Entries));
+		Cache->NumUsed = 0U;
+	}
+	_XAie_SyncRelease(DevInst, Token);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api drops the cached values of a contiguous block of registers.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative offset of the first register
+* @param	Size: Number of 32-bit registers
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_ShadowInvalidateRange(XAie_DevInst *DevInst, u64 RegOff, u32 Size)
+{
+	XAie_ShadowCache *Cache = DevInst->ShadowCache;
+
+	if((Cache == NULL) || (Cache->NumUsed == 0U)) {
+		return;
+	}
+
+	for(u32 i = 0U; i < Size; i++) {
+		_XAie_ShadowDelete(Cache, RegOff + i * 4U);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This api drops the cached values of the registers written by transaction
+* commands, which are issued to the backend without going through the cache.
+*
+* @param	DevInst: Device instance pointer
+* @param	Cmds: Array of transaction commands
+* @param	NumCmds: Number of commands
+*
+* @return	None.
+*
+* @note		Internal only. Called with the device lock held. Shim DMA BD
+*		configurations and custom operations may write any register,
+*		they drop the whole cache.
+*
+******************************************************************************/
+void _XAie_ShadowInvalidateForCmds(XAie_DevInst *DevInst,
+		const XAie_TxnCmd *Cmds, u32 NumCmds)
+{
+	if(DevInst->ShadowCache == NULL) {
+		return;
+	}
+
+	for(u32 i = 0U; i < NumCmds; i++) {
+		switch(Cmds[i].Opcode) {
+		case XAIE_IO_WRITE:
+		case XAIE_IO_MASKWRITE:
+			_XAie_ShadowInvalidateRange(DevInst, Cmds[i].RegOff,
+					1U);
+			break;
+		case XAIE_IO_BLOCKWRITE:
+		case XAIE_IO_BLOCKSET:
+			_XAie_ShadowInvalidateRange(DevInst, Cmds[i].RegOff,
+					Cmds[i].Size);
+			break;
+		case XAIE_IO_MASKPOLL:
+			break;
+		default:
+			_XAie_ShadowInvalidate(DevInst);
+			return;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This api drops the cached values which may have been changed by a backend
+* operation. Operations which only manage resources or access registers outside
+* of the partition keep the cache intact.
+*
+* @param	DevInst: Device instance pointer
+* @param	Op: Backend operation code
+* @param	Arg: Argument of the backend operation
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_ShadowInvalidateForOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op,
+		const void *Arg)
+{
+	const XAie_ShimDmaBdArgs *BdArgs;
+
+	switch(Op) {
+	case XAIE_BACKEND_OP_NPIMASKPOLL32:
+	case XAIE_BACKEND_OP_SET_PROTREG:
+	case XAIE_BACKEND_OP_REQUEST_RESOURCE:
+	case XAIE_BACKEND_OP_RELEASE_RESOURCE:
+	case XAIE_BACKEND_OP_FREE_RESOURCE:
+	case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
+	case XAIE_BACKEND_OP_GET_RSC_STAT:
+	case XAIE_BACKEND_OP_UPDATE_NPI_ADDR:
+	case XAIE_BACKEND_OP_FLUSH_WRITES:
+		break;
+	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
+		BdArgs = (const XAie_ShimDmaBdArgs *)Arg;
+		_XAie_ShadowInvalidateRange(DevInst, BdArgs->Addr,
+				BdArgs->NumBdWords);
+		break;
+	default:
+		_XAie_ShadowInvalidate(DevInst);
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This api writes a register through the shadow cache. The write is dropped if
+* the register is known to hold the value already.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative register offset
+* @param	Value: 32-bit value to write
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_ShadowWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
+{
+	AieRC RC;
+	XAie_ShadowEntry *Entry;
+	XAie_ShadowCache *Cache = DevInst->ShadowCache;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if(!_XAie_ShadowIsCacheable(DevInst, RegOff)) {
+		return Backend->Ops.Write32(DevInst->IOInst, RegOff, Value);
+	}
+
+	Entry = _XAie_ShadowLookup(Cache, RegOff);
+	if((Entry != NULL) && (Entry->Value == Value)) {
+		return XAIE_OK;
+	}
+
+	RC = Backend->Ops.Write32(DevInst->IOInst, RegOff, Value);
+	if(RC != XAIE_OK) {
+		_XAie_ShadowDelete(Cache, RegOff);
+		return RC;
+	}
+
+	_XAie_ShadowStore(Cache, Entry, RegOff, Value);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api performs a masked write of a register through the shadow cache. The
+* new register value is computed from the cached value and written in full.
+* On a miss, the register is read back once if the backend supports it.
+* Otherwise, the masked write is forwarded to the backend uncached.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative register offset
+* @param	Mask: Mask to be applied to the register
+* @param	Value: 32-bit value to write
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_ShadowMaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	AieRC RC;
+	u32 Old, New;
+	XAie_ShadowEntry *Entry;
+	XAie_ShadowCache *Cache = DevInst->ShadowCache;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if(!_XAie_ShadowIsCacheable(DevInst, RegOff)) {
+		return Backend->Ops.MaskWrite32(DevInst->IOInst, RegOff, Mask,
+				Value);
+	}
+
+	Entry = _XAie_ShadowLookup(Cache, RegOff);
+	if(Entry != NULL) {
+		Old = Entry->Value;
+	} else if(_XAie_ShadowCanReadBack(DevInst)) {
+		RC = Backend->Ops.Read32(DevInst->IOInst, RegOff, &Old);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	} else {
+		return Backend->Ops.MaskWrite32(DevInst->IOInst, RegOff, Mask,
+				Value);
+	}
+
+	New = (Old & ~Mask) | Value;
+	if(New != Old) {
+		RC = Backend->Ops.Write32(DevInst->IOInst, RegOff, New);
+		if(RC != XAIE_OK) {
+			_XAie_ShadowDelete(Cache, RegOff);
+			return RC;
+		}
+	}
+
+	_XAie_ShadowStore(Cache, Entry, RegOff, New);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api writes a block of registers through the shadow cache. Data is either
+* taken from an array or a single value is replicated.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative offset of the first register
+* @param	Data: Array of values, or NULL to write Value to every register
+* @param	Value: Value to write if Data is NULL
+* @param	Size: Number of 32-bit registers
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. The block is dropped only if every register in it
+*		is cached with the value being written.
+*
+******************************************************************************/
+static AieRC _XAie_ShadowBlockOp(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Value, u32 Size)
+{
+	AieRC RC;
+	u8 TileType, Redundant = XAIE_ENABLE;
+	u32 Idx, StartIdx, TileOff;
+	XAie_ShadowCache *Cache = DevInst->ShadowCache;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	TileOff = _XAie_ShadowFindRange(DevInst, RegOff, &TileType, &Idx);
+	if((TileType >= XAIEGBL_TILE_TYPE_MAX) || (Size == 0U) ||
+			(Idx == Cache->NumRanges[TileType]) ||
+			(Cache->Ranges[TileType][Idx].Start >=
+			 TileOff + Size * 4U)) {
+		/* Block does not touch any cacheable register */
+		if(Data != NULL) {
+			return Backend->Ops.BlockWrite32(DevInst->IOInst,
+					RegOff, Data, Size);
+		}
+
+		return Backend->Ops.BlockSet32(DevInst->IOInst, RegOff, Value,
+				Size);
+	}
+
+	StartIdx = Idx;
+	for(u32 i = 0U; i < Size; i++) {
+		XAie_ShadowEntry *Entry;
+		u32 Word = (Data != NULL) ? Data[i] : Value;
+
+		if(!_XAie_ShadowInRange(Cache, TileType, &Idx,
+					TileOff + i * 4U)) {
+			Redundant = XAIE_DISABLE;
+			break;
+		}
+
+		Entry = _XAie_ShadowLookup(Cache, RegOff + i * 4U);
+		if((Entry == NULL) || (Entry->Value != Word)) {
+			Redundant = XAIE_DISABLE;
+			break;
+		}
+	}
+
+	if(Redundant == XAIE_ENABLE) {
+		return XAIE_OK;
+	}
+
+	if(Data != NULL) {
+		RC = Backend->Ops.BlockWrite32(DevInst->IOInst, RegOff, Data,
+				Size);
+	} else {
+		RC = Backend->Ops.BlockSet32(DevInst->IOInst, RegOff, Value,
+				Size);
+	}
+	if(RC != XAIE_OK) {
+		_XAie_ShadowInvalidateRange(DevInst, RegOff, Size);
+		return RC;
+	}
+
+	Idx = StartIdx;
+	for(u32 i = 0U; i < Size; i++) {
+		u64 WordOff = RegOff + i * 4U;
+
+		if(_XAie_ShadowInRange(Cache, TileType, &Idx,
+					TileOff + i * 4U)) {
+			_XAie_ShadowStore(Cache,
+					_XAie_ShadowLookup(Cache, WordOff),
+					WordOff, (Data != NULL) ? Data[i] : Value);
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api writes a block of registers through the shadow cache.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative offset of the first register
+* @param	Data: Pointer to the data to write
+* @param	Size: Number of 32-bit words
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_ShadowBlockWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	return _XAie_ShadowBlockOp(DevInst, RegOff, Data, 0U, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api sets a block of registers to a value through the shadow cache.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Partition relative offset of the first register
+* @param	Data: 32-bit value to write
+* @param	Size: Number of 32-bit words
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_ShadowBlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data,
+		u32 Size)
+{
+	return _XAie_ShadowBlockOp(DevInst, RegOff, NULL, Data, Size);
+}
+
+/** @} */
@@ -0,0 +1,70 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_shadow.h
+* @{
+*
+* Header file for the shadow register cache of the device instance.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_SHADOW_H
+#define XAIE_SHADOW_H
+
+/***************************** Include Files *********************************/
+#include "xaie_io.h"
+#include "xaiegbl.h"
+
+/**************************** Type Definitions *******************************/
+/* Tile relative register range which can be served from the shadow cache */
+typedef struct {
+	u32 Start;	/* First byte offset of the range */
+	u32 End;	/* First byte offset past the range */
+} XAie_ShadowRange;
+
+typedef struct {
+	u64 RegOff;	/* Partition relative register offset */
+	u32 Value;	/* Last value written to the register */
+	u8 State;	/* Empty, valid or deleted */
+} XAie_ShadowEntry;
+
+struct XAie_ShadowCache {
+	XAie_ShadowEntry *Entries;	/* Open addressed hash table */
+	u32 Capacity;			/* Number of entries, power of 2 */
+	u32 NumUsed;			/* Valid and deleted entries */
+	XAie_ShadowRange *Ranges[XAIEGBL_TILE_TYPE_MAX];
+	u32 NumRanges[XAIEGBL_TILE_TYPE_MAX];
+};
+
+/************************** Function Prototypes  *****************************/
+AieRC _XAie_ShadowEnable(XAie_DevInst *DevInst);
+void _XAie_ShadowFree(XAie_DevInst *DevInst);
+void _XAie_ShadowInvalidate(XAie_DevInst *DevInst);
+void _XAie_ShadowInvalidateRange(XAie_DevInst *DevInst, u64 RegOff, u32 Size);
+void _XAie_ShadowInvalidateForCmds(XAie_DevInst *DevInst,
+		const XAie_TxnCmd *Cmds, u32 NumCmds);
+u8 _XAie_ShadowIsStaticReg(XAie_DevInst *DevInst, u64 RegOff);
+void _XAie_ShadowInvalidateForOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op,
+		const void *Arg);
+AieRC _XAie_ShadowWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Value);
+AieRC _XAie_ShadowMaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask,
+		u32 Value);
+AieRC _XAie_ShadowBlockWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size);
+AieRC _XAie_ShadowBlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data,
+		u32 Size);
+
+#endif	/* end of protection macro */
+/** @} */
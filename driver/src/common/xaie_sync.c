@@ -0,0 +1,429 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_sync.c
+* @{
+*
+* This file contains the thread synchronization of the device instance. Once
+* enabled, the IO helpers, the resource manager and the transaction lists of
+* the device instance can be used from multiple threads.
+*
+* Registers of different columns are independent of each other, so the
+* accesses are sharded by column. An access within a single column takes the
+* device lock shared and the lock of the column, accesses to different
+* columns proceed in parallel. Operations spanning the partition, such as
+* backend operations, resource requests, transaction flushes and accesses
+* crossing a column boundary, take the device lock exclusively. The device
+* lock may be taken again by the thread holding it, so an operation running
+* under it can call back in to the IO helpers.
+*
+* Only the memory mapped backends can be accessed in parallel. For the other
+* backends, and while the shadow register cache is enabled, every access
+* takes the device lock exclusively.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#endif
+#include <stdlib.h>
+
+#include "xaie_helper.h"
+#include "xaie_io.h"
+#include "xaie_sync.h"
+
+/************************** Function Definitions *****************************/
+#ifdef __linux__
+
+/****************************** Type Definitions *****************************/
+struct XAie_SyncCtx {
+	pthread_rwlock_t DevLock;	/* Shared by column accesses */
+	pthread_mutex_t TxnLock;	/* Protects the transaction lists */
+	pthread_mutex_t *ColLocks;	/* Lock of each column */
+	u32 NumCols;			/* Number of column locks */
+	pthread_t Owner;		/* Exclusive holder of DevLock */
+	u32 Depth;			/* Nesting depth of the holder */
+};
+
+/*****************************************************************************/
+/**
+*
+* This api checks if the calling thread holds the device lock exclusively.
+*
+* @param	Ctx: Synchronization context of the device instance.
+*
+* @return	1 if the device lock is held by the calling thread, 0 otherwise.
+*
+* @note		Internal only. Owner is only written by the thread holding the
+*		device lock, a thread can only read its own id back.
+*
+******************************************************************************/
+static inline u8 _XAie_SyncIsOwner(XAie_SyncCtx *Ctx)
+{
+	if(__atomic_load_n(&Ctx->Depth, __ATOMIC_ACQUIRE) == 0U) {
+		return 0U;
+	}
+
+	return pthread_equal(__atomic_load_n(&Ctx->Owner, __ATOMIC_RELAXED),
+			pthread_self()) ? 1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks if the registers of different columns can be accessed from
+* multiple threads with the current backend of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	1 if the accesses can be sharded by column, 0 otherwise.
+*
+* @note		Internal only. The backend type is checked on each access as
+*		the backend may be switched at runtime.
+*
+******************************************************************************/
+static inline u8 _XAie_SyncCanShard(XAie_DevInst *DevInst)
+{
+	XAie_BackendType Type = DevInst->Backend->Type;
+
+	if(DevInst->ShadowCache != NULL) {
+		return 0U;
+	}
+
+	return ((Type == XAIE_IO_BACKEND_LINUX) ||
+		(Type == XAIE_IO_BACKEND_METAL) ||
+		(Type == XAIE_IO_BACKEND_BAREMETAL)) ? 1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api initializes the locks of a synchronization context.
+*
+* @param	Ctx: Synchronization context with the column locks allocated.
+* @param	NumCols: Number of columns of the partition.
+*
+* @return	XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note		Internal only. Nothing is left initialized on failure.
+*
+******************************************************************************/
+static AieRC _XAie_SyncInitLocks(XAie_SyncCtx *Ctx, u32 NumCols)
+{
+	pthread_rwlockattr_t Attr;
+	int Ret;
+
+	/* Partition wide operations must not starve behind column accesses */
+	pthread_rwlockattr_init(&Attr);
+#ifdef __GLIBC__
+	pthread_rwlockattr_setkind_np(&Attr,
+			PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+	Ret = pthread_rwlock_init(&Ctx->DevLock, &Attr);
+	pthread_rwlockattr_destroy(&Attr);
+	if(Ret != 0) {
+		return XAIE_ERR;
+	}
+
+	if(pthread_mutex_init(&Ctx->TxnLock, NULL) != 0) {
+		pthread_rwlock_destroy(&Ctx->DevLock);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumCols; i++) {
+		if(pthread_mutex_init(&Ctx->ColLocks[i], NULL) != 0) {
+			while(i > 0U) {
+				pthread_mutex_destroy(&Ctx->ColLocks[--i]);
+			}
+			pthread_mutex_destroy(&Ctx->TxnLock);
+			pthread_rwlock_destroy(&Ctx->DevLock);
+			return XAIE_ERR;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api allocates the locks of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_SyncEnable(XAie_DevInst *DevInst)
+{
+	XAie_SyncCtx *Ctx;
+
+	if(DevInst->Sync != NULL) {
+		return XAIE_OK;
+	}
+
+	Ctx = (XAie_SyncCtx *)calloc(1U, sizeof(*Ctx));
+	if(Ctx == NULL) {
+		XAIE_ERROR("Failed to allocate memory for device locks\n");
+		return XAIE_ERR;
+	}
+
+	Ctx->ColLocks = (pthread_mutex_t *)calloc(DevInst->NumCols,
+			sizeof(*Ctx->ColLocks));
+	if(Ctx->ColLocks == NULL) {
+		XAIE_ERROR("Failed to allocate memory for column locks\n");
+		free(Ctx);
+		return XAIE_ERR;
+	}
+
+	if(_XAie_SyncInitLocks(Ctx, DevInst->NumCols) != XAIE_OK) {
+		XAIE_ERROR("Failed to initialize device locks\n");
+		free(Ctx->ColLocks);
+		free(Ctx);
+		return XAIE_ERR;
+	}
+
+	Ctx->NumCols = DevInst->NumCols;
+	DevInst->Sync = Ctx;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api releases the locks of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only. No lock may be held by any thread.
+*
+******************************************************************************/
+void _XAie_SyncFree(XAie_DevInst *DevInst)
+{
+	XAie_SyncCtx *Ctx = DevInst->Sync;
+
+	if(Ctx == NULL) {
+		return;
+	}
+
+	for(u32 i = 0U; i < Ctx->NumCols; i++) {
+		pthread_mutex_destroy(&Ctx->ColLocks[i]);
+	}
+	pthread_mutex_destroy(&Ctx->TxnLock);
+	pthread_rwlock_destroy(&Ctx->DevLock);
+	free(Ctx->ColLocks);
+	free(Ctx);
+	DevInst->Sync = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api takes the device lock exclusively. The lock may be taken again by
+* the thread holding it.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_SYNC_DEVICE.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+u32 _XAie_SyncLockDevice(XAie_DevInst *DevInst)
+{
+	XAie_SyncCtx *Ctx = DevInst->Sync;
+
+	if(_XAie_SyncIsOwner(Ctx)) {
+		__atomic_store_n(&Ctx->Depth, Ctx->Depth + 1U,
+				__ATOMIC_RELAXED);
+		return XAIE_SYNC_DEVICE;
+	}
+
+	pthread_rwlock_wrlock(&Ctx->DevLock);
+	__atomic_store_n(&Ctx->Owner, pthread_self(), __ATOMIC_RELAXED);
+	__atomic_store_n(&Ctx->Depth, 1U, __ATOMIC_RELEASE);
+
+	return XAIE_SYNC_DEVICE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api takes the lock covering a range of registers. Ranges within a
+* single column take the device lock shared and the lock of the column, other
+* ranges take the device lock exclusively.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Partition relative offset of the first register.
+* @param	Bytes: Number of bytes accessed, at least 1.
+*
+* @return	Index of the column lock, XAIE_SYNC_DEVICE if the device lock
+*		was taken exclusively or XAIE_SYNC_NONE if the calling thread
+*		already holds the device lock.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+u32 _XAie_SyncLockRange(XAie_DevInst *DevInst, u64 RegOff, u32 Bytes)
+{
+	XAie_SyncCtx *Ctx = DevInst->Sync;
+	u64 Col = RegOff >> DevInst->DevProp.ColShift;
+	u64 LastCol = (RegOff + (Bytes > 0U ? Bytes - 1U : 0U)) >>
+		DevInst->DevProp.ColShift;
+
+	if(_XAie_SyncIsOwner(Ctx)) {
+		return XAIE_SYNC_NONE;
+	}
+
+	if((Col != LastCol) || (Col >= Ctx->NumCols) ||
+			!_XAie_SyncCanShard(DevInst)) {
+		return _XAie_SyncLockDevice(DevInst);
+	}
+
+	pthread_rwlock_rdlock(&Ctx->DevLock);
+	pthread_mutex_lock(&Ctx->ColLocks[Col]);
+
+	return (u32)Col;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api releases a lock taken by _XAie_SyncLockRange or
+* _XAie_SyncLockDevice.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Token: Token returned when the lock was taken.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_SyncUnlock(XAie_DevInst *DevInst, u32 Token)
+{
+	XAie_SyncCtx *Ctx = DevInst->Sync;
+
+	if(Token == XAIE_SYNC_DEVICE) {
+		if(Ctx->Depth > 1U) {
+			__atomic_store_n(&Ctx->Depth, Ctx->Depth - 1U,
+					__ATOMIC_RELAXED);
+			return;
+		}
+
+		__atomic_store_n(&Ctx->Depth, 0U, __ATOMIC_RELEASE);
+		pthread_rwlock_unlock(&Ctx->DevLock);
+		return;
+	}
+
+	pthread_mutex_unlock(&Ctx->ColLocks[Token]);
+	pthread_rwlock_unlock(&Ctx->DevLock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api takes the lock of the transaction lists of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only. The lock is never held while accessing the
+*		device.
+*
+******************************************************************************/
+void _XAie_SyncLockTxnList(XAie_DevInst *DevInst)
+{
+	if(DevInst->Sync != NULL) {
+		pthread_mutex_lock(&DevInst->Sync->TxnLock);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This api releases the lock of the transaction lists of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_SyncUnlockTxnList(XAie_DevInst *DevInst)
+{
+	if(DevInst->Sync != NULL) {
+		pthread_mutex_unlock(&DevInst->Sync->TxnLock);
+	}
+}
+
+#else
+
+AieRC _XAie_SyncEnable(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+	XAIE_ERROR("Thread safety is not supported on this platform\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+void _XAie_SyncFree(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+u32 _XAie_SyncLockDevice(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+	return XAIE_SYNC_NONE;
+}
+
+u32 _XAie_SyncLockRange(XAie_DevInst *DevInst, u64 RegOff, u32 Bytes)
+{
+	(void)DevInst;
+	(void)RegOff;
+	(void)Bytes;
+	return XAIE_SYNC_NONE;
+}
+
+void _XAie_SyncUnlock(XAie_DevInst *DevInst, u32 Token)
+{
+	(void)DevInst;
+	(void)Token;
+}
+
+void _XAie_SyncLockTxnList(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+void _XAie_SyncUnlockTxnList(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+#endif /* __linux__ */
+
+/** @} */
@@ -0,0 +1,500 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txn_parallel.c
+* @{
+*
+* This file contains the column parallel execution of transactions for the
+* memory mapped IO backends. Register writes to different columns of the
+* partition are independent of each other, so the commands of a transaction are
+* split by column and issued from a pool of worker threads. Commands of a
+* column are issued in order by the same worker. The workers are created once
+* per device instance and reused by the following transactions. MaskPoll and
+* custom operations act as barriers, all the commands recorded before them are
+* completed before they are executed and no command recorded after them is
+* issued before they complete.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+#include "xaie_helper.h"
+#include "xaie_io.h"
+#include "xaie_txn_parallel.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_TXN_PARALLEL_MIN_CMDS	256U
+#define XAIE_TXN_PARALLEL_MAX_WORKERS	16U
+
+/************************** Function Definitions *****************************/
+#ifdef __linux__
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	pthread_mutex_t Lock;
+	pthread_cond_t Cond;
+	u32 Count;	/* Number of workers */
+	u32 Waiting;	/* Number of workers waiting at the barrier */
+	u32 Generation;	/* Incremented each time the barrier is released */
+} XAie_TxnBarrier;
+
+typedef struct {
+	XAie_TxnPool *Pool;
+	u32 Id;
+} XAie_TxnWorker;
+
+/*
+ * Worker threads of a device instance, created on the first column parallel
+ * execution and kept until XAie_Finish(). The submitting thread is worker 0.
+ */
+struct XAie_TxnPool {
+	XAie_DevInst *DevInst;
+	pthread_mutex_t Lock;		/* Protects the job fields */
+	pthread_cond_t JobCond;		/* Signalled when a job is posted */
+	pthread_cond_t DoneCond;	/* Signalled when the threads are done */
+	XAie_TxnBarrier Barrier;
+	pthread_t Threads[XAIE_TXN_PARALLEL_MAX_WORKERS - 1U];
+	XAie_TxnWorker Workers[XAIE_TXN_PARALLEL_MAX_WORKERS];
+	u32 NumWorkers;
+	u32 NumThreads;			/* Number of worker threads */
+	u32 Job;			/* Incremented for each job */
+	u32 NumDone;			/* Threads done with the job */
+	u8 Exit;			/* Set to stop the threads */
+	XAie_TxnInst *TxnInst;		/* Transaction of the job */
+	AieRC RC;	/* Status of the barrier operations */
+	AieRC WorkerRC[XAIE_TXN_PARALLEL_MAX_WORKERS];
+};
+
+/*****************************************************************************/
+/**
+*
+* This api blocks the calling worker until all the workers reach the barrier.
+*
+* @param	Barrier: Barrier shared by the workers.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnBarrierWait(XAie_TxnBarrier *Barrier)
+{
+	u32 Generation;
+
+	pthread_mutex_lock(&Barrier->Lock);
+	Generation = Barrier->Generation;
+	Barrier->Waiting++;
+	if(Barrier->Waiting == Barrier->Count) {
+		Barrier->Waiting = 0U;
+		Barrier->Generation++;
+		pthread_cond_broadcast(&Barrier->Cond);
+	} else {
+		while(Generation == Barrier->Generation) {
+			pthread_cond_wait(&Barrier->Cond, &Barrier->Lock);
+		}
+	}
+	pthread_mutex_unlock(&Barrier->Lock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks if a command targets a single column of the partition and
+* returns the column.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Cmd: Transaction command.
+* @param	Col: Pointer to return the column.
+*
+* @return	XAIE_ENABLE if the command can be issued out of order with
+*		commands of other columns, XAIE_DISABLE for barrier commands.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_TxnGetCmdCol(XAie_DevInst *DevInst,
+		const XAie_TxnCmd *Cmd, u8 *Col)
+{
+	if((Cmd->Opcode != XAIE_IO_WRITE) &&
+			(Cmd->Opcode != XAIE_IO_BLOCKWRITE) &&
+			(Cmd->Opcode != XAIE_IO_BLOCKSET)) {
+		return XAIE_DISABLE;
+	}
+
+	if((Cmd->RegOff >> DevInst->DevProp.ColShift) >= DevInst->NumCols) {
+		return XAIE_DISABLE;
+	}
+
+	*Col = _XAie_GetColfromRegOff(DevInst, Cmd->RegOff);
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api walks the command buffer and issues the commands of the columns
+* owned by a worker. Barrier commands are issued by the first worker once all
+* the workers have reached them.
+*
+* @param	Pool: Worker pool running the job.
+* @param	Id: Index of the worker.
+*
+* @return	None.
+*
+* @note		Internal only. A failing worker stops issuing commands of its
+*		columns, the other workers stop at the next barrier.
+*
+******************************************************************************/
+static void _XAie_TxnRunColumns(XAie_TxnPool *Pool, u32 Id)
+{
+	XAie_TxnInst *TxnInst = Pool->TxnInst;
+	AieRC RC = XAIE_OK;
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u8 Col;
+
+		if(_XAie_TxnGetCmdCol(Pool->DevInst, Cmd, &Col) ==
+				XAIE_DISABLE) {
+			Pool->WorkerRC[Id] = RC;
+			_XAie_TxnBarrierWait(&Pool->Barrier);
+			if(Id == 0U) {
+				for(u32 w = 0U; w < Pool->NumWorkers; w++) {
+					if(Pool->WorkerRC[w] != XAIE_OK) {
+						Pool->RC = Pool->WorkerRC[w];
+					}
+				}
+
+				if(Pool->RC == XAIE_OK) {
+					Pool->RC = _XAie_ExecuteCmd(
+							Pool->DevInst, Cmd);
+				}
+			}
+			_XAie_TxnBarrierWait(&Pool->Barrier);
+
+			if(Pool->RC != XAIE_OK) {
+				return;
+			}
+			continue;
+		}
+
+		if((RC != XAIE_OK) || ((Col % Pool->NumWorkers) != Id)) {
+			continue;
+		}
+
+		RC = _XAie_ExecuteCmd(Pool->DevInst, Cmd);
+	}
+
+	Pool->WorkerRC[Id] = RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api is the body of the worker threads. A worker waits for a job to be
+* posted, runs its columns of the job and reports back, until the pool is
+* destroyed.
+*
+* @param	Arg: Worker.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_TxnColumnWorker(void *Arg)
+{
+	XAie_TxnWorker *Worker = (XAie_TxnWorker *)Arg;
+	XAie_TxnPool *Pool = Worker->Pool;
+	u32 Job = 0U;
+
+	while(1) {
+		pthread_mutex_lock(&Pool->Lock);
+		while((Pool->Job == Job) && (Pool->Exit == 0U)) {
+			pthread_cond_wait(&Pool->JobCond, &Pool->Lock);
+		}
+		if(Pool->Exit != 0U) {
+			pthread_mutex_unlock(&Pool->Lock);
+			break;
+		}
+		Job = Pool->Job;
+		pthread_mutex_unlock(&Pool->Lock);
+
+		_XAie_TxnRunColumns(Pool, Worker->Id);
+
+		pthread_mutex_lock(&Pool->Lock);
+		Pool->NumDone++;
+		if(Pool->NumDone == Pool->NumThreads) {
+			pthread_cond_signal(&Pool->DoneCond);
+		}
+		pthread_mutex_unlock(&Pool->Lock);
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api stops the worker threads of a pool and releases the pool.
+*
+* @param	Pool: Worker pool.
+*
+* @return	None.
+*
+* @note		Internal only. No job may be running.
+*
+******************************************************************************/
+static void _XAie_TxnPoolDestroy(XAie_TxnPool *Pool)
+{
+	pthread_mutex_lock(&Pool->Lock);
+	Pool->Exit = 1U;
+	pthread_cond_broadcast(&Pool->JobCond);
+	pthread_mutex_unlock(&Pool->Lock);
+
+	for(u32 i = 0U; i < Pool->NumThreads; i++) {
+		pthread_join(Pool->Threads[i], NULL);
+	}
+
+	pthread_cond_destroy(&Pool->Barrier.Cond);
+	pthread_mutex_destroy(&Pool->Barrier.Lock);
+	pthread_cond_destroy(&Pool->DoneCond);
+	pthread_cond_destroy(&Pool->JobCond);
+	pthread_mutex_destroy(&Pool->Lock);
+	free(Pool);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api creates the worker pool of a device instance. One worker is used
+* per column of the partition, up to the number of online processors.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	Pointer to the pool on success and NULL if the transactions
+*		have to be executed serially.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static XAie_TxnPool *_XAie_TxnPoolCreate(XAie_DevInst *DevInst)
+{
+	XAie_TxnPool *Pool;
+	long NumCpus;
+	u32 NumWorkers;
+
+	NumCpus = sysconf(_SC_NPROCESSORS_ONLN);
+	NumWorkers = DevInst->NumCols;
+	if((NumCpus > 0) && ((u32)NumCpus < NumWorkers)) {
+		NumWorkers = (u32)NumCpus;
+	}
+	if(NumWorkers > XAIE_TXN_PARALLEL_MAX_WORKERS) {
+		NumWorkers = XAIE_TXN_PARALLEL_MAX_WORKERS;
+	}
+	if(NumWorkers < 2U) {
+		return NULL;
+	}
+
+	Pool = (XAie_TxnPool *)calloc(1U, sizeof(*Pool));
+	if(Pool == NULL) {
+		return NULL;
+	}
+
+	if(pthread_mutex_init(&Pool->Lock, NULL) != 0) {
+		free(Pool);
+		return NULL;
+	}
+	if(pthread_cond_init(&Pool->JobCond, NULL) != 0) {
+		pthread_mutex_destroy(&Pool->Lock);
+		free(Pool);
+		return NULL;
+	}
+	if(pthread_cond_init(&Pool->DoneCond, NULL) != 0) {
+		pthread_cond_destroy(&Pool->JobCond);
+		pthread_mutex_destroy(&Pool->Lock);
+		free(Pool);
+		return NULL;
+	}
+	if(pthread_mutex_init(&Pool->Barrier.Lock, NULL) != 0) {
+		pthread_cond_destroy(&Pool->DoneCond);
+		pthread_cond_destroy(&Pool->JobCond);
+		pthread_mutex_destroy(&Pool->Lock);
+		free(Pool);
+		return NULL;
+	}
+	if(pthread_cond_init(&Pool->Barrier.Cond, NULL) != 0) {
+		pthread_mutex_destroy(&Pool->Barrier.Lock);
+		pthread_cond_destroy(&Pool->DoneCond);
+		pthread_cond_destroy(&Pool->JobCond);
+		pthread_mutex_destroy(&Pool->Lock);
+		free(Pool);
+		return NULL;
+	}
+
+	Pool->DevInst = DevInst;
+	for(Pool->NumThreads = 0U; Pool->NumThreads < NumWorkers - 1U;
+			Pool->NumThreads++) {
+		XAie_TxnWorker *Worker = &Pool->Workers[Pool->NumThreads + 1U];
+
+		Worker->Pool = Pool;
+		Worker->Id = Pool->NumThreads + 1U;
+		if(pthread_create(&Pool->Threads[Pool->NumThreads], NULL,
+					_XAie_TxnColumnWorker, Worker) != 0) {
+			XAIE_DBG("Failed to create worker %d, continuing with "
+					"%d workers\n", Pool->NumThreads + 1U,
+					Pool->NumThreads + 1U);
+			break;
+		}
+	}
+
+	if(Pool->NumThreads == 0U) {
+		_XAie_TxnPoolDestroy(Pool);
+		return NULL;
+	}
+
+	/*
+	 * The threads only use the barrier once they picked up a job, and a
+	 * job is posted under the pool lock after this point, so the count
+	 * is visible to them without signalling the barrier.
+	 */
+	Pool->NumWorkers = Pool->NumThreads + 1U;
+	Pool->Barrier.Count = Pool->NumWorkers;
+
+	return Pool;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api executes the commands of a transaction instance on the worker pool
+* of the device instance, one column of the partition being owned by a single
+* worker. The pool is created on the first call.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Transaction instance to execute.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the
+*		transaction has to be executed serially and error code on
+*		failure.
+*
+* @note		Internal only. Only the memory mapped backends can be accessed
+*		from multiple threads. Small transactions, single column
+*		partitions and single core systems are executed serially.
+*		Transactions of a device instance are flushed one at a time,
+*		so the pool runs a single job at once.
+*
+******************************************************************************/
+AieRC _XAie_TxnExecuteParallel(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	XAie_TxnPool *Pool;
+	XAie_BackendType Type = DevInst->Backend->Type;
+
+	if(((Type != XAIE_IO_BACKEND_METAL) &&
+			(Type != XAIE_IO_BACKEND_BAREMETAL)) ||
+			(TxnInst->NumCmds < XAIE_TXN_PARALLEL_MIN_CMDS)) {
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	/*
+	 * Custom operations run on a worker and may call back in to the
+	 * driver, which must happen on the thread holding the device lock.
+	 */
+	if((DevInst->Sync != NULL) && (DevInst->TxnCustomOps != NULL)) {
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	if(DevInst->TxnPool == NULL) {
+		DevInst->TxnPool = _XAie_TxnPoolCreate(DevInst);
+		if(DevInst->TxnPool == NULL) {
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+	}
+	Pool = DevInst->TxnPool;
+
+	XAIE_DBG("Executing %d commands on %d workers\n", TxnInst->NumCmds,
+			Pool->NumWorkers);
+
+	pthread_mutex_lock(&Pool->Lock);
+	Pool->TxnInst = TxnInst;
+	Pool->RC = XAIE_OK;
+	Pool->NumDone = 0U;
+	Pool->Job++;
+	pthread_cond_broadcast(&Pool->JobCond);
+	pthread_mutex_unlock(&Pool->Lock);
+
+	_XAie_TxnRunColumns(Pool, 0U);
+
+	pthread_mutex_lock(&Pool->Lock);
+	while(Pool->NumDone != Pool->NumThreads) {
+		pthread_cond_wait(&Pool->DoneCond, &Pool->Lock);
+	}
+	pthread_mutex_unlock(&Pool->Lock);
+
+	for(u32 w = 0U; w < Pool->NumWorkers; w++) {
+		if(Pool->WorkerRC[w] != XAIE_OK) {
+			Pool->RC = Pool->WorkerRC[w];
+		}
+	}
+
+	return Pool->RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api stops the worker threads of the device instance, if any.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only. Called from XAie_Finish().
+*
+******************************************************************************/
+void _XAie_TxnPoolFree(XAie_DevInst *DevInst)
+{
+	if(DevInst->TxnPool == NULL) {
+		return;
+	}
+
+	_XAie_TxnPoolDestroy(DevInst->TxnPool);
+	DevInst->TxnPool = NULL;
+}
+
+#else
+
+AieRC _XAie_TxnExecuteParallel(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	(void)DevInst;
+	(void)TxnInst;
+
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+void _XAie_TxnPoolFree(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+#endif /* __linux__ */
+
+/** @} */
@@ -309,6 +309,46 @@ AieRC XAie_CoreWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc, u32 TimeOut)
 	return CoreMod->WaitForDone(DevInst, Loc, TimeOut, CoreMod);
 }
 
+/*****************************************************************************/
+/*
+*
+* This API returns the register condition met once the core of an AIE tile is
+* done, for the waits on several channels and cores of XAie_WaitForDoneSet().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+* @param	RegAddr: Pointer to return the status register address.
+* @param	Mask: Pointer to return the mask of the status bits.
+* @param	Value: Pointer to return the value of the status bits once the
+*		core is done.
+* @param	ErrMask: Pointer to return the mask of the status bits set when
+*		the core halted on an error, 0 if the register does not report
+*		errors.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_CoreGetWaitCond(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u64 *RegAddr, u32 *Mask, u32 *Value, u32 *ErrMask)
+{
+	u8 TileType;
+	const XAie_CoreMod *CoreMod;
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	CoreMod->GetDoneCond(DevInst, Loc, CoreMod, RegAddr, Mask, Value,
+			ErrMask);
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /*
 *
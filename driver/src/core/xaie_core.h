@@ -134,6 +134,8 @@ AieRC XAie_ClearCoreDisableEventOccurred(XAie_DevInst *DevInst,
 		XAie_LocType Loc);
 AieRC XAie_CoreProcessorBusEnable(XAie_DevInst *DevInst, XAie_LocType Loc);
 AieRC XAie_CoreProcessorBusDisable(XAie_DevInst *DevInst, XAie_LocType Loc);
+AieRC _XAie_CoreGetWaitCond(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u64 *RegAddr, u32 *Mask, u32 *Value, u32 *ErrMask);
 
 #endif		/* end of protection macro */
 /** @} */
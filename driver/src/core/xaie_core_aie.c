@@ -109,6 +109,38 @@ AieRC _XAie_CoreEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAie_MaskWrite32(DevInst, RegAddr, Mask, Value);
 }
 
+/*****************************************************************************/
+/*
+*
+* This API returns the register condition of the core of a AIE tile being
+* done.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+* @param	CoreMod: Pointer to the core module data structure.
+* @param	RegAddr: Pointer to return the address of the status register.
+* @param	Mask: Pointer to return the mask of the status register.
+* @param	Value: Pointer to return the masked value of a done core.
+* @param	ErrMask: Pointer to return the mask of the error bits of the
+*		register.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_CoreGetDoneCond(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const struct XAie_CoreMod *CoreMod, u64 *RegAddr, u32 *Mask,
+		u32 *Value, u32 *ErrMask)
+{
+	*Mask = CoreMod->CoreEvent->DisableEventOccurred.Mask;
+	*Value = 1U << CoreMod->CoreEvent->DisableEventOccurred.Lsb;
+	/* The error halt bit is in the core status, not in this register */
+	*ErrMask = 0U;
+	*RegAddr = CoreMod->CoreEvent->EnableEventOff +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+}
+
 /*****************************************************************************/
 /*
 *
@@ -130,14 +162,11 @@ AieRC _XAie_CoreEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 AieRC _XAie_CoreWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u32 TimeOut, const struct XAie_CoreMod *CoreMod)
 {
-	u32 Mask, Value;
+	u32 Mask, Value, ErrMask;
 	u64 EventRegAddr;
 
-	Mask = CoreMod->CoreEvent->DisableEventOccurred.Mask;
-	Value = 1U << CoreMod->CoreEvent->DisableEventOccurred.Lsb;
-	EventRegAddr = CoreMod->CoreEvent->EnableEventOff +
-		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
-
+	_XAie_CoreGetDoneCond(DevInst, Loc, CoreMod, &EventRegAddr, &Mask,
+			&Value, &ErrMask);
 	if(XAie_MaskPoll(DevInst, EventRegAddr, Mask, Value, TimeOut) !=
 			XAIE_OK) {
 		XAIE_DBG("Status poll time out\n");
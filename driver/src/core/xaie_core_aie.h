@@ -29,6 +29,9 @@ AieRC _XAie_CoreConfigureDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const struct XAie_CoreMod *CoreMod);
 AieRC _XAie_CoreEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const struct XAie_CoreMod *CoreMod);
+void _XAie_CoreGetDoneCond(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const struct XAie_CoreMod *CoreMod, u64 *RegAddr, u32 *Mask,
+		u32 *Value, u32 *ErrMask);
 AieRC _XAie_CoreWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u32 TimeOut, const struct XAie_CoreMod *CoreMod);
 AieRC _XAie_CoreReadDoneBit(XAie_DevInst *DevInst, XAie_LocType Loc,
@@ -81,6 +81,37 @@ AieRC _XAieMl_CoreEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAie_MaskWrite32(DevInst, RegAddr, Mask, Value);
 }
 
+/*****************************************************************************/
+/*
+*
+* This API returns the register condition of the core of a AIE tile being
+* done.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+* @param	CoreMod: Pointer to the core module data structure.
+* @param	RegAddr: Pointer to return the address of the status register.
+* @param	Mask: Pointer to return the mask of the status register.
+* @param	Value: Pointer to return the masked value of a done core.
+* @param	ErrMask: Pointer to return the mask of the error bits of the
+*		register.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAieMl_CoreGetDoneCond(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const struct XAie_CoreMod *CoreMod, u64 *RegAddr, u32 *Mask,
+		u32 *Value, u32 *ErrMask)
+{
+	*Mask = CoreMod->CoreSts->Done.Mask;
+	*Value = 1U << CoreMod->CoreSts->Done.Lsb;
+	*ErrMask = CoreMod->CoreSts->ErrHalt.Mask;
+	*RegAddr = CoreMod->CoreSts->RegOff +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+}
+
 /*****************************************************************************/
 /*
 *
@@ -102,15 +133,11 @@ AieRC _XAieMl_CoreEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 AieRC _XAieMl_CoreWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u32 TimeOut, const struct XAie_CoreMod *CoreMod)
 {
-	u32 Mask, Value;
+	u32 Mask, Value, ErrMask;
 	u64 RegAddr;
 
-	Mask = CoreMod->CoreSts->Done.Mask;
-	Value = 1U << CoreMod->CoreSts->Done.Lsb;
-
-	RegAddr = CoreMod->CoreSts->RegOff +
-		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
-
+	_XAieMl_CoreGetDoneCond(DevInst, Loc, CoreMod, &RegAddr, &Mask,
+			&Value, &ErrMask);
 	if(XAie_MaskPoll(DevInst, RegAddr, Mask, Value, TimeOut) !=
 			XAIE_OK) {
 		XAIE_DBG("Status poll time out\n");
@@ -32,6 +32,7 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
 #include <string.h>
 #include "xaie_dma.h"
 #include "xaie_feature_config.h"
@@ -821,6 +822,422 @@ AieRC XAie_DmaWriteBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 	return DmaMod->WriteBd(DevInst, DmaDesc, Loc, BdNum);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API writes a run of consecutive buffer descriptors of a tile. The
+* descriptors are encoded into one buffer and, when the buffer descriptor
+* registers of the tile are laid out back to back, written with a single block
+* write.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	FirstBd: Hardware BD number of the first descriptor.
+* @param	Descs: Array of initialized Dma Descriptors.
+* @param	Count: Number of descriptors in the array.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Descs[i] is written to BD FirstBd + i. Shim BDs are written one
+*		by one through the backend as the buffer address of each BD may
+*		need to be translated. If the registers of a BD are followed by
+*		reserved words, one block write per BD is issued.
+*
+******************************************************************************/
+AieRC XAie_DmaWriteBds(XAie_DevInst *DevInst, XAie_LocType Loc, u8 FirstBd,
+		XAie_DmaDesc *Descs, u8 Count)
+{
+	AieRC RC;
+	u8 TileType, NumBdWords = 0U;
+	u32 Stride, *BdWords;
+	u64 Addr;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) || (Descs == XAIE_NULL) || (Count == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	for(u8 i = 0U; i < Count; i++) {
+		if(Descs[i].IsReady != XAIE_COMPONENT_IS_READY) {
+			XAIE_ERROR("Invalid Arguments\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		if(Descs[i].TileType != TileType) {
+			XAIE_ERROR("Tile type mismatch\n");
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	DmaMod = Descs[0U].DmaMod;
+	if((u32)FirstBd + Count > DmaMod->NumBds) {
+		XAIE_ERROR("Invalid BD number\n");
+		return XAIE_INVALID_BD_NUM;
+	}
+
+	if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+		for(u8 i = 0U; i < Count; i++) {
+			RC = DmaMod->WriteBd(DevInst, &Descs[i], Loc,
+					FirstBd + i);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		return XAIE_OK;
+	}
+
+	Stride = DmaMod->IdxOffset / sizeof(u32);
+	BdWords = (u32 *)calloc((size_t)Count * Stride, sizeof(u32));
+	if(BdWords == XAIE_NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u8 i = 0U; i < Count; i++) {
+		RC = DmaMod->CompileBd(&Descs[i], &BdWords[i * Stride],
+				&NumBdWords);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to compile buffer descriptor %d\n",
+					FirstBd + i);
+			free(BdWords);
+			return RC;
+		}
+	}
+
+	Addr = DmaMod->BaseAddr + FirstBd * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	if(NumBdWords == Stride) {
+		RC = XAie_BlockWrite32(DevInst, Addr, BdWords,
+				(u32)Count * NumBdWords);
+	} else {
+		for(u8 i = 0U; i < Count; i++) {
+			RC = XAie_BlockWrite32(DevInst,
+					Addr + i * DmaMod->IdxOffset,
+					&BdWords[i * Stride], NumBdWords);
+			if(RC != XAIE_OK) {
+				break;
+			}
+		}
+	}
+
+	free(BdWords);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API encodes a Dma Descriptor into the words of the buffer descriptor
+* registers. The image can then be written to the hardware with
+* XAie_DmaWriteBdImage as many times as required, without encoding the
+* descriptor again.
+*
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Image: Pointer to the buffer descriptor image to be filled.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The image is only valid for tiles of the type the descriptor
+*		was initialized for.
+*
+******************************************************************************/
+AieRC XAie_DmaCompileBd(XAie_DmaDesc *DmaDesc, XAie_DmaBdImage *Image)
+{
+	AieRC RC;
+
+	if((DmaDesc == XAIE_NULL) || (Image == XAIE_NULL) ||
+			(DmaDesc->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memset((void *)Image, 0U, sizeof(*Image));
+	RC = DmaDesc->DmaMod->CompileBd(DmaDesc, Image->Words,
+			&Image->NumWords);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to compile buffer descriptor\n");
+		return RC;
+	}
+
+	Image->DmaMod = DmaDesc->DmaMod;
+	Image->MemInst = DmaDesc->MemInst;
+	Image->Address = DmaDesc->AddrDesc.Address;
+	Image->Len = (DmaDesc->AddrDesc.Length +
+			DmaDesc->DmaMod->BdProp->LenActualOffset) <<
+		XAIE_DMA_32BIT_TXFER_LEN;
+	Image->TileType = DmaDesc->TileType;
+	Image->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a buffer descriptor image compiled with XAie_DmaCompileBd to
+* the buffer descriptor registers with a single block write.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+* @param	Image: Compiled buffer descriptor image.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Shim BDs are written through the backend, which may need the
+*		memory object of the buffer to map its address.
+*
+******************************************************************************/
+AieRC XAie_DmaWriteBdImage(XAie_DevInst *DevInst, XAie_LocType Loc, u8 BdNum,
+		const XAie_DmaBdImage *Image)
+{
+	u64 Addr;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) || (Image == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Image->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Image->TileType != DevInst->DevOps->GetTTypefromLoc(DevInst, Loc)) {
+		XAIE_ERROR("Tile type mismatch\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	DmaMod = Image->DmaMod;
+	if(BdNum >= DmaMod->NumBds) {
+		XAIE_ERROR("Invalid BD number\n");
+		return XAIE_INVALID_BD_NUM;
+	}
+
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	if(Image->TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+		u32 BdWord[XAIE_DMA_BD_MAX_WORDS];
+		XAie_ShimDmaBdArgs Args;
+
+		/* The backend may rewrite the address words */
+		memcpy(BdWord, Image->Words, Image->NumWords * sizeof(u32));
+		Args.NumBdWords = Image->NumWords;
+		Args.BdWords = &BdWord[0U];
+		Args.Loc = Loc;
+		Args.VAddr = Image->Address;
+		Args.BdNum = BdNum;
+		Args.Addr = Addr;
+		Args.MemInst = Image->MemInst;
+
+		return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_SHIMDMABD,
+				(void *)&Args);
+	}
+
+	return XAie_BlockWrite32(DevInst, Addr, Image->Words, Image->NumWords);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates a bit field of a buffer descriptor image.
+*
+* @param	Image: Buffer descriptor image.
+* @param	Fld: Bit field of the buffer descriptor.
+* @param	Val: Value of the field.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline void _XAie_DmaBdImageSetField(XAie_DmaBdImage *Image,
+		const XAie_RegBdFldAttr *Fld, u64 Val)
+{
+	Image->Words[Fld->Idx] = (Image->Words[Fld->Idx] & ~Fld->Mask) |
+		XAie_SetField(Val, Fld->Lsb, Fld->Mask);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API encodes the buffer address of a buffer descriptor image.
+*
+* @param	Image: Compiled buffer descriptor image.
+* @param	Addr: Buffer address, aligned to the BD address alignment.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_DmaBdImageEncodeAddr(XAie_DmaBdImage *Image, u64 Addr)
+{
+	const XAie_DmaBdProp *BdProp = Image->DmaMod->BdProp;
+
+	Addr = Addr >> BdProp->AddrAlignShift;
+	if(Image->TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+		_XAie_DmaBdImageSetField(Image,
+				&BdProp->Buffer->ShimDmaBuff.AddrLow,
+				Addr >> BdProp->Buffer->ShimDmaBuff.AddrLow.Lsb);
+		_XAie_DmaBdImageSetField(Image,
+				&BdProp->Buffer->ShimDmaBuff.AddrHigh,
+				Addr >> 32U);
+	} else {
+		_XAie_DmaBdImageSetField(Image,
+				&BdProp->Buffer->TileDmaBuff.BaseAddr, Addr);
+	}
+
+	Image->Address = Addr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API patches the buffer address of a compiled buffer descriptor image in
+* place.
+*
+* @param	Image: Compiled buffer descriptor image.
+* @param	Addr: Buffer address.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The memory object of the image is cleared as the address is not
+*		an offset to the memory object. Use XAie_DmaBdImageSetOffset to
+*		repoint an image backed by a memory object.
+*
+******************************************************************************/
+AieRC XAie_DmaBdImageSetAddr(XAie_DmaBdImage *Image, u64 Addr)
+{
+	const XAie_DmaBdProp *BdProp;
+
+	if((Image == XAIE_NULL) ||
+			(Image->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	BdProp = Image->DmaMod->BdProp;
+	if(((Addr & BdProp->AddrAlignMask) != 0U) ||
+			((Addr + Image->Len) > BdProp->AddrMax)) {
+		XAIE_ERROR("Invalid Address\n");
+		return XAIE_INVALID_ADDRESS;
+	}
+
+	_XAie_DmaBdImageEncodeAddr(Image, Addr);
+	Image->MemInst = XAIE_NULL;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API patches the buffer offset to the memory object of a compiled buffer
+* descriptor image in place. The memory object of the image is kept.
+*
+* @param	Image: Compiled buffer descriptor image, compiled from a
+*		descriptor set with XAie_DmaSetAddrOffsetLen.
+* @param	Offset: Buffer address offset to the memory object.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_DmaBdImageSetOffset(XAie_DmaBdImage *Image, u64 Offset)
+{
+	u64 Addr;
+	const XAie_DmaBdProp *BdProp;
+
+	if((Image == XAIE_NULL) ||
+			(Image->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Image->MemInst == XAIE_NULL) {
+		XAIE_ERROR("BD image is not backed by a memory object\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Offset >= Image->MemInst->Size) ||
+			(Offset + Image->Len > Image->MemInst->Size)) {
+		XAIE_ERROR("Invalid Offset\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Addr = Offset + Image->MemInst->DevAddr;
+	BdProp = Image->DmaMod->BdProp;
+	if(((Addr & BdProp->AddrAlignMask) != 0U) ||
+			((Offset + Image->Len) > BdProp->AddrMax)) {
+		XAIE_ERROR("Invalid Address Offset\n");
+		return XAIE_INVALID_ADDRESS;
+	}
+
+	_XAie_DmaBdImageEncodeAddr(Image, Addr);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API patches the buffer length of a compiled buffer descriptor image in
+* place.
+*
+* @param	Image: Compiled buffer descriptor image.
+* @param	Len: Length of the buffer in bytes.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The buffer shall still fit the address range of the DMA, and
+*		the memory object of the image if any.
+*
+******************************************************************************/
+AieRC XAie_DmaBdImageSetLen(XAie_DmaBdImage *Image, u32 Len)
+{
+	u64 Addr;
+	const XAie_DmaBdProp *BdProp;
+
+	if((Image == XAIE_NULL) ||
+			(Image->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	BdProp = Image->DmaMod->BdProp;
+	if((Len >> XAIE_DMA_32BIT_TXFER_LEN) < BdProp->LenActualOffset) {
+		XAIE_ERROR("Invalid Length\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Addr = Image->Address << BdProp->AddrAlignShift;
+	if(Image->MemInst != XAIE_NULL) {
+		Addr -= Image->MemInst->DevAddr;
+		if(Addr + Len > Image->MemInst->Size) {
+			XAIE_ERROR("Invalid Length\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	if((Addr + Len) > BdProp->AddrMax) {
+		XAIE_ERROR("Invalid Address\n");
+		return XAIE_INVALID_ADDRESS;
+	}
+
+	_XAie_DmaBdImageSetField(Image, &BdProp->BufferLen,
+			(Len >> XAIE_DMA_32BIT_TXFER_LEN) -
+			BdProp->LenActualOffset);
+	Image->Len = Len;
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1170,6 +1587,7 @@ AieRC XAie_DmaChannelPushBdToQueue(XAie_DevInst *DevInst, XAie_LocType Loc,
 
 	RC = DmaMod->BdChValidity(BdNum, ChNum);
 	if (RC != XAIE_OK) {
+		XAIE_ERROR("Invalid BdNum, ChNum combination\n");
 		return RC;
 	}
 
@@ -1380,6 +1798,60 @@ AieRC XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 	return DmaMod->WaitforDone(DevInst, Loc, DmaMod, ChNum, Dir, TimeOutUs);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API returns the register condition met once a DMA channel is done, for
+* the waits on several channels and cores of XAie_WaitForDoneSet().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param	RegAddr: Pointer to return the status register address.
+* @param	Mask: Pointer to return the mask of the status bits.
+* @param	Value: Pointer to return the value of the status bits once the
+*		channel is done.
+* @param	ErrMask: Pointer to return the mask of the status bits set when
+*		the channel is in error, 0 if the device does not report
+*		errors in the status register.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+AieRC _XAie_DmaGetWaitCond(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
+		XAie_DmaDirection Dir, u64 *RegAddr, u32 *Mask, u32 *Value,
+		u32 *ErrMask)
+{
+	u8 TileType;
+	const XAie_DmaMod *DmaMod;
+
+	if(Dir >= DMA_MAX) {
+		XAIE_ERROR("Invalid DMA direction\n");
+		return XAIE_INVALID_DMA_DIRECTION;
+	}
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if((TileType >= XAIEGBL_TILE_TYPE_MAX) ||
+			(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	if(ChNum >= DmaMod->NumChannels) {
+		XAIE_ERROR("Invalid Channel number\n");
+		return XAIE_INVALID_CHANNEL_NUM;
+	}
+
+	DmaMod->GetDoneCond(DevInst, Loc, DmaMod, ChNum, Dir, RegAddr, Mask,
+			Value, ErrMask);
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1601,6 +2073,7 @@ AieRC XAie_DmaChannelSetStartQueueGeneric(XAie_DevInst *DevInst,
 		}
 		RC = DmaMod->BdChValidity(StartBd, ChNum);
 		if(RC != XAIE_OK) {
+			XAIE_ERROR("Invalid BdNum, ChNum combination\n");
 			return RC;
 		}
 	} else {
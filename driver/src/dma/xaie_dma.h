@@ -99,6 +99,14 @@ AieRC XAie_DmaSetInterleaveEnable(XAie_DmaDesc *DmaDesc, u8 DoubleBuff,
 		u8 IntrleaveCount, u16 IntrleaveCurr);
 AieRC XAie_DmaWriteBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
+AieRC XAie_DmaWriteBds(XAie_DevInst *DevInst, XAie_LocType Loc, u8 FirstBd,
+		XAie_DmaDesc *Descs, u8 Count);
+AieRC XAie_DmaCompileBd(XAie_DmaDesc *DmaDesc, XAie_DmaBdImage *Image);
+AieRC XAie_DmaWriteBdImage(XAie_DevInst *DevInst, XAie_LocType Loc, u8 BdNum,
+		const XAie_DmaBdImage *Image);
+AieRC XAie_DmaBdImageSetAddr(XAie_DmaBdImage *Image, u64 Addr);
+AieRC XAie_DmaBdImageSetOffset(XAie_DmaBdImage *Image, u64 Offset);
+AieRC XAie_DmaBdImageSetLen(XAie_DmaBdImage *Image, u32 Len);
 AieRC XAie_DmaReadBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
 AieRC XAie_DmaChannelResetAll(XAie_DevInst *DevInst, XAie_LocType Loc,
@@ -150,5 +158,8 @@ AieRC XAie_DmaUpdateBdLen(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Len,
 		u8 BdNum);
 AieRC XAie_DmaUpdateBdAddr(XAie_DevInst *DevInst, XAie_LocType Loc, u64 Addr,
 		u8 BdNum);
+AieRC _XAie_DmaGetWaitCond(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
+		XAie_DmaDirection Dir, u64 *RegAddr, u32 *Mask, u32 *Value,
+		u32 *ErrMask);
 
 #endif		/* end of protection macro */
@@ -199,34 +199,23 @@ AieRC _XAie_DmaSetInterleaveEnable(XAie_DmaDesc *DmaDesc, u8 DoubleBuff,
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIE Shim Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the words of the buffer descriptor registers. This API is specific to
+* AIE Shim Tiles only.
 *
-* @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Array to store the buffer descriptor words.
+* @param	NumBdWords: Pointer to store the number of buffer descriptor words.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIE Shim Tiles only.
 *
 ******************************************************************************/
-AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAie_ShimDmaCompileBd(XAie_DmaDesc *DmaDesc, u32 *BdWord,
+		u8 *NumBdWords)
 {
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIE_SHIMDMA_NUM_BD_WORDS];
-	XAie_ShimDmaBdArgs Args;
-	const XAie_DmaMod *DmaMod;
-	const XAie_DmaBdProp *BdProp;
-
-	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
-	BdProp = DmaMod->BdProp;
-
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+	const XAie_DmaBdProp *BdProp = DmaDesc->DmaMod->BdProp;
 
 	BdWord[0U] = XAie_SetField(DmaDesc->AddrDesc.Address,
 			BdProp->Buffer->ShimDmaBuff.AddrLow.Lsb,
@@ -293,9 +282,50 @@ AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->Pkt->EnPkt.Lsb,
 				BdProp->Pkt->EnPkt.Mask);
 
+	*NumBdWords = XAIE_SHIMDMA_NUM_BD_WORDS;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIE Shim Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIE Shim Tiles only.
+*
+******************************************************************************/
+AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u8 NumBdWords;
+	u64 Addr;
+	u64 BdBaseAddr;
+	u32 BdWord[XAIE_SHIMDMA_NUM_BD_WORDS];
+	XAie_ShimDmaBdArgs Args;
+	const XAie_DmaMod *DmaMod;
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+
+	RC = _XAie_ShimDmaCompileBd(DmaDesc, BdWord, &NumBdWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
-	Args.NumBdWords = XAIE_SHIMDMA_NUM_BD_WORDS;
+	Args.NumBdWords = NumBdWords;
 	Args.BdWords = &BdWord[0U];
 	Args.Loc = Loc;
 	Args.VAddr = DmaDesc->AddrDesc.Address;
@@ -339,12 +369,9 @@ AieRC _XAie_ShimDmaReadBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
 	/* Setup DmaDesc with values read from bd registers */
-	for(u8 i = 0; i < XAIE_SHIMDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Read32(DevInst, Addr, &BdWord[i]);
-		if (RC != XAIE_OK) {
-			return RC;
-		}
-		Addr += 4U;
+	RC = XAie_BlockRead32(DevInst, Addr, BdWord, XAIE_SHIMDMA_NUM_BD_WORDS);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
 	DmaDesc->AddrDesc.Address |= XAie_GetField(BdWord[0U],
@@ -420,33 +447,23 @@ AieRC _XAie_ShimDmaReadBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIE Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the words of the buffer descriptor registers. This API is specific to
+* AIE Tiles only.
 *
-* @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Array to store the buffer descriptor words.
+* @param	NumBdWords: Pointer to store the number of buffer descriptor words.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIE Tiles only.
 *
 ******************************************************************************/
-AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAie_TileDmaCompileBd(XAie_DmaDesc *DmaDesc, u32 *BdWord,
+		u8 *NumBdWords)
 {
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIE_TILEDMA_NUM_BD_WORDS];
-	const XAie_DmaMod *DmaMod;
-	const XAie_DmaBdProp *BdProp;
-
-	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
-	BdProp = DmaMod->BdProp;
-
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+	const XAie_DmaBdProp *BdProp = DmaDesc->DmaMod->BdProp;
 
 	/* AcqLockId and RelLockId are the same in AIE */
 	BdWord[0U] = XAie_SetField(DmaDesc->LockDesc.LockAcqId,
@@ -561,9 +578,49 @@ AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->BufferLen.Lsb,
 				BdProp->BufferLen.Mask);
 
+	*NumBdWords = XAIE_TILEDMA_NUM_BD_WORDS;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIE Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIE Tiles only.
+*
+******************************************************************************/
+AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u8 NumBdWords;
+	u64 Addr;
+	u64 BdBaseAddr;
+	u32 BdWord[XAIE_TILEDMA_NUM_BD_WORDS];
+	const XAie_DmaMod *DmaMod;
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+
+	RC = _XAie_TileDmaCompileBd(DmaDesc, BdWord, &NumBdWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
-	return XAie_BlockWrite32(DevInst, Addr, BdWord, XAIE_TILEDMA_NUM_BD_WORDS);
+	return XAie_BlockWrite32(DevInst, Addr, BdWord, NumBdWords);
 }
 
 /*****************************************************************************/
@@ -597,12 +654,9 @@ AieRC _XAie_TileDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
 	/* Setup DmaDesc with values read from bd registers */
-	for(u8 i = 0; i < XAIE_TILEDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Read32(DevInst, Addr, &BdWord[i]);
-		if (RC != XAIE_OK) {
-			return RC;
-		}
-		Addr += 4U;
+	RC = XAie_BlockRead32(DevInst, Addr, BdWord, XAIE_TILEDMA_NUM_BD_WORDS);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
 	DmaDesc->LockDesc.LockAcqId = XAie_GetField(BdWord[0U],
@@ -792,37 +846,68 @@ AieRC _XAie_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 /*****************************************************************************/
 /**
 *
-* This API is used to wait on Shim DMA channel to be completed.
+* This API returns the register condition of a DMA channel being done.
 *
 * @param	DevInst: Device Instance
 * @param	Loc: Location of AIE Tile
 * @param	DmaMod: Dma module pointer
 * @param	ChNum: Channel number of the DMA.
 * @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
-* @param        TimeOutUs - Minimum timeout value in micro seconds.
+* @param	RegAddr: Pointer to return the address of the status register.
+* @param	Mask: Pointer to return the mask of the status register.
+* @param	Value: Pointer to return the masked value of a done channel.
+* @param	ErrMask: Pointer to return the mask of the error bits of the
+*		status register.
 *
-* @return	XAIE_OK on success, Error code on failure.
+* @return	None.
 *
 * @note		Internal only. For AIE Tiles only.
 *
 ******************************************************************************/
-AieRC _XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
+void _XAie_DmaGetDoneCond(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
-		u32 TimeOutUs)
+		u64 *RegAddr, u32 *Mask, u32 *Value, u32 *ErrMask)
 {
-	u64 Addr;
-	u32 Mask, Value;
-
-	Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+	*RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
 		DmaMod->ChStatusBase + Dir * DmaMod->ChStatusOffset;
-	Mask = DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Status.Mask |
+	*Mask = DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Status.Mask |
 		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.StartQSize.Mask |
 		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Stalled.Mask;
 
 	/* This will check the stalled and start queue size bits to be zero */
-	Value = XAIE_DMA_STATUS_IDLE <<
+	*Value = XAIE_DMA_STATUS_IDLE <<
 		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Status.Lsb;
 
+	/* The status register of AIE DMA channels has no error bits */
+	*ErrMask = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is used to wait on Shim DMA channel to be completed.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	DmaMod: Dma module pointer
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param        TimeOutUs - Minimum timeout value in micro seconds.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIE Tiles only.
+*
+******************************************************************************/
+AieRC _XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u32 TimeOutUs)
+{
+	u64 Addr;
+	u32 Mask, Value, ErrMask;
+
+	_XAie_DmaGetDoneCond(DevInst, Loc, DmaMod, ChNum, Dir, &Addr, &Mask,
+			&Value, &ErrMask);
 	if(XAie_MaskPoll(DevInst, Addr, Mask, Value, TimeOutUs) !=
 			XAIE_OK) {
 		XAIE_DBG("Wait for done timed out\n");
@@ -249,40 +249,30 @@ static AieRC _XAieMl_DmaMemTileCheckPaddingConfig(XAie_DmaDesc *DmaDesc)
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIEML Memory Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the words of the buffer descriptor registers. This API is specific to
+* AIEML Mem Tiles only.
 *
-* @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Array to store the buffer descriptor words.
+* @param	NumBdWords: Pointer to store the number of buffer descriptor words.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIEML Mem Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAieMl_MemTileDmaCompileBd(XAie_DmaDesc *DmaDesc, u32 *BdWord,
+		u8 *NumBdWords)
 {
 	AieRC RC;
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIEML_MEMTILEDMA_NUM_BD_WORDS];
-	const XAie_DmaMod *DmaMod;
-	const XAie_DmaBdProp *BdProp;
+	const XAie_DmaBdProp *BdProp = DmaDesc->DmaMod->BdProp;
 
 	RC = _XAieMl_DmaMemTileCheckPaddingConfig(DmaDesc);
 	if (RC != XAIE_OK) {
 		return RC;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
-	BdProp = DmaMod->BdProp;
-
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	/* Setup BdWord with the right values from DmaDesc */
 	BdWord[0U] = XAie_SetField(DmaDesc->PktDesc.PktEn,
 			BdProp->Pkt->EnPkt.Lsb, BdProp->Pkt->EnPkt.Mask) |
@@ -383,9 +373,49 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->Lock->AieMlDmaLock.LckAcqEn.Lsb,
 				BdProp->Lock->AieMlDmaLock.LckAcqEn.Mask);
 
+	*NumBdWords = XAIEML_MEMTILEDMA_NUM_BD_WORDS;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIEML Memory Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Mem Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u8 NumBdWords;
+	u64 Addr;
+	u64 BdBaseAddr;
+	u32 BdWord[XAIEML_MEMTILEDMA_NUM_BD_WORDS];
+	const XAie_DmaMod *DmaMod;
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+
+	RC = _XAieMl_MemTileDmaCompileBd(DmaDesc, BdWord, &NumBdWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
-	return XAie_BlockWrite32(DevInst, Addr, BdWord, XAIEML_MEMTILEDMA_NUM_BD_WORDS);
+	return XAie_BlockWrite32(DevInst, Addr, BdWord, NumBdWords);
 }
 
 /*****************************************************************************/
@@ -420,12 +450,9 @@ AieRC _XAieMl_MemTileDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
 	/* Setup DmaDesc with values read from bd registers */
-	for(u8 i = 0; i < XAIEML_MEMTILEDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Read32(DevInst, Addr, &BdWord[i]);
-		if (RC != XAIE_OK) {
-			return RC;
-		}
-		Addr += 4U;
+	RC = XAie_BlockRead32(DevInst, Addr, BdWord, XAIEML_MEMTILEDMA_NUM_BD_WORDS);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
 	DmaDesc->PktDesc.PktEn = XAie_GetField(BdWord[0U],
@@ -548,33 +575,23 @@ AieRC _XAieMl_MemTileDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIEML Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the words of the buffer descriptor registers. This API is specific to
+* AIEML Tiles only.
 *
-* @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Array to store the buffer descriptor words.
+* @param	NumBdWords: Pointer to store the number of buffer descriptor words.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIEML Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAieMl_TileDmaCompileBd(XAie_DmaDesc *DmaDesc, u32 *BdWord,
+		u8 *NumBdWords)
 {
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIEML_TILEDMA_NUM_BD_WORDS];
-	const XAie_DmaMod *DmaMod;
-	const XAie_DmaBdProp *BdProp;
-
-	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
-	BdProp = DmaMod->BdProp;
-
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+	const XAie_DmaBdProp *BdProp = DmaDesc->DmaMod->BdProp;
 
 	/* Setup BdWord with the right values from DmaDesc */
 	BdWord[0U] = XAie_SetField(DmaDesc->AddrDesc.Address,
@@ -651,9 +668,49 @@ AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->BdEn->TlastSuppress.Lsb,
 				BdProp->BdEn->TlastSuppress.Mask);
 
+	*NumBdWords = XAIEML_TILEDMA_NUM_BD_WORDS;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIEML Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u8 NumBdWords;
+	u64 Addr;
+	u64 BdBaseAddr;
+	u32 BdWord[XAIEML_TILEDMA_NUM_BD_WORDS];
+	const XAie_DmaMod *DmaMod;
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+
+	RC = _XAieMl_TileDmaCompileBd(DmaDesc, BdWord, &NumBdWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
-	return XAie_BlockWrite32(DevInst, Addr, BdWord, XAIEML_TILEDMA_NUM_BD_WORDS);
+	return XAie_BlockWrite32(DevInst, Addr, BdWord, NumBdWords);
 }
 
 /*****************************************************************************/
@@ -687,12 +744,9 @@ AieRC _XAieMl_TileDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
 	/* Setup DmaDesc with values read from bd registers */
-	for(u8 i = 0; i < XAIEML_TILEDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Read32(DevInst, Addr, &BdWord[i]);
-		if (RC != XAIE_OK) {
-			return RC;
-		}
-		Addr += 4U;
+	RC = XAie_BlockRead32(DevInst, Addr, BdWord, XAIEML_TILEDMA_NUM_BD_WORDS);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
 	DmaDesc->AddrDesc.Address = XAie_GetField(BdWord[0U],
@@ -787,34 +841,23 @@ AieRC _XAieMl_TileDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIEML Shim Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the words of the buffer descriptor registers. This API is specific to
+* AIEML Shim Tiles only.
 *
-* @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Array to store the buffer descriptor words.
+* @param	NumBdWords: Pointer to store the number of buffer descriptor words.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIEML Shim Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAieMl_ShimDmaCompileBd(XAie_DmaDesc *DmaDesc, u32 *BdWord,
+		u8 *NumBdWords)
 {
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIEML_SHIMDMA_NUM_BD_WORDS];
-	XAie_ShimDmaBdArgs Args;
-	const XAie_DmaMod *DmaMod;
-	const XAie_DmaBdProp *BdProp;
-
-	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
-	BdProp = DmaMod->BdProp;
-
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+	const XAie_DmaBdProp *BdProp = DmaDesc->DmaMod->BdProp;
 
 	/* Setup BdWord with the right values from DmaDesc */
 	BdWord[0U] = XAie_SetField(DmaDesc->AddrDesc.Length,
@@ -908,9 +951,50 @@ AieRC _XAieMl_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->BdEn->TlastSuppress.Lsb,
 				BdProp->BdEn->TlastSuppress.Mask);
 
+	*NumBdWords = XAIEML_SHIMDMA_NUM_BD_WORDS;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIEML Shim Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Shim Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u8 NumBdWords;
+	u64 Addr;
+	u64 BdBaseAddr;
+	u32 BdWord[XAIEML_SHIMDMA_NUM_BD_WORDS];
+	XAie_ShimDmaBdArgs Args;
+	const XAie_DmaMod *DmaMod;
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
+
+	RC = _XAieMl_ShimDmaCompileBd(DmaDesc, BdWord, &NumBdWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
-	Args.NumBdWords = XAIEML_SHIMDMA_NUM_BD_WORDS;
+	Args.NumBdWords = NumBdWords;
 	Args.BdWords = &BdWord[0U];
 	Args.Loc = Loc;
 	Args.VAddr = DmaDesc->AddrDesc.Address;
@@ -952,12 +1036,9 @@ AieRC _XAieMl_ShimDmaReadBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
 	/* Setup DmaDesc with values read from bd registers */
-	for(u8 i = 0; i < XAIEML_SHIMDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Read32(DevInst, Addr, &BdWord[i]);
-		if (RC != XAIE_OK) {
-			return RC;
-		}
-		Addr += 4U;
+	RC = XAie_BlockRead32(DevInst, Addr, BdWord, XAIEML_SHIMDMA_NUM_BD_WORDS);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
 	/* Setup BdWord with the right values from DmaDesc */
@@ -1127,32 +1208,33 @@ AieRC _XAieMl_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 /*****************************************************************************/
 /**
 *
-* This API is used to wait on Shim DMA channel to be completed.
+* This API returns the register condition of a DMA channel being done.
 *
 * @param	DevInst: Device Instance
 * @param	Loc: Location of AIE Tile
 * @param	DmaMod: Dma module pointer
 * @param	ChNum: Channel number of the DMA.
 * @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
-* @param        TimeOutUs - Minimum timeout value in micro seconds.
+* @param	RegAddr: Pointer to return the address of the status register.
+* @param	Mask: Pointer to return the mask of the status register.
+* @param	Value: Pointer to return the masked value of a done channel.
+* @param	ErrMask: Pointer to return the mask of the error bits of the
+*		status register.
 *
-* @return	XAIE_OK on success, Error code on failure.
+* @return	None.
 *
 * @note		Internal only. For AIEML Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
+void _XAieMl_DmaGetDoneCond(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
-		u32 TimeOutUs)
+		u64 *RegAddr, u32 *Mask, u32 *Value, u32 *ErrMask)
 {
-	u64 Addr;
-	u32 Mask, Value;
-
-	Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+	*RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
 		DmaMod->ChStatusBase + ChNum * XAIEML_DMA_STATUS_CHNUM_OFFSET +
 		Dir * DmaMod->ChStatusOffset;
 
-	Mask = DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.TaskQSize.Mask |
+	*Mask = DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.TaskQSize.Mask |
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.ChannelRunning.Mask |
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.StalledLockAcq.Mask |
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.StalledLockRel.Mask |
@@ -1160,9 +1242,38 @@ AieRC _XAieMl_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.StalledTCT.Mask;
 
 	/* This will check the stalled and start queue size bits to be zero */
-	Value = XAIEML_DMA_STATUS_CHANNEL_NOT_RUNNING <<
+	*Value = XAIEML_DMA_STATUS_CHANNEL_NOT_RUNNING <<
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.ChannelRunning.Lsb;
 
+	*ErrMask = DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.ErrMask[Dir];
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is used to wait on Shim DMA channel to be completed.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	DmaMod: Dma module pointer
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param        TimeOutUs - Minimum timeout value in micro seconds.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u32 TimeOutUs)
+{
+	u64 Addr;
+	u32 Mask, Value, ErrMask;
+
+	_XAieMl_DmaGetDoneCond(DevInst, Loc, DmaMod, ChNum, Dir, &Addr, &Mask,
+			&Value, &ErrMask);
 	if(XAie_MaskPoll(DevInst, Addr, Mask, Value, TimeOutUs) !=
 			XAIE_OK) {
 		XAIE_DBG("Wait for done timed out\n");
@@ -1218,7 +1329,6 @@ AieRC _XAieMl_MemTileDmaCheckBdChValidity(u8 BdNum, u8 ChNum)
 	else if((BdNum >= 24U) && ((ChNum % 2U) == 1U))
 		return XAIE_OK;
 
-	XAIE_ERROR("Invalid BdNum, ChNum combination\n");
 	return XAIE_INVALID_ARGS;
 }
 
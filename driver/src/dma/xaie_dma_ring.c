@@ -0,0 +1,779 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_ring.c
+* @{
+*
+* This file contains the buffer descriptor rings of AIE DMA channels. A ring
+* reserves a number of BDs of a tile which are legal for one DMA channel and
+* hands them out in order to the tasks submitted to the channel. The BDs of a
+* task are chained with their next BD fields and the first BD is pushed to the
+* task queue of the channel. BDs are given back to the ring when the pending
+* BD count of the channel shows that their task has completed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+#include <pthread.h>
+#endif
+#include <stdlib.h>
+
+#include "xaie_dma_ring.h"
+#include "xaie_helper.h"
+#include "xaie_sync.h"
+#include "xaiegbl_regdef.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_DMA_BDRING_MAX_BDS		64U	/* Size of the BD mask */
+
+/****************************** Type Definitions *****************************/
+struct XAie_DmaBdRing {
+	XAie_DevInst *DevInst;
+	const XAie_DmaMod *DmaMod;
+	XAie_LocType Loc;
+	XAie_DmaDirection Dir;
+	u8 ChNum;
+	u8 TileType;
+	u8 Bds[XAIE_DMA_BDRING_MAX_BDS];	/* BDs reserved by the ring */
+	u8 NumBds;
+	u8 Head;		/* Slot of the oldest BD in use */
+	u8 NumUsed;		/* Number of BDs in use from the head */
+	u8 TaskLen[XAIE_DMA_BDRING_MAX_BDS];	/* BDs of each queued task */
+	u8 TaskHead;		/* Oldest queued task */
+	u8 NumTasks;		/* Tasks queued and not completed */
+	u8 Cyclic;		/* A cyclic chain has been submitted */
+	u64 NumSubmitted;	/* Tasks submitted since the ring was created */
+	u64 NumCompleted;	/* Tasks known to have completed */
+	u64 BdMask;		/* Mask of the reserved BDs */
+	XAie_DmaBdRing *Next;	/* Next ring of the device instance */
+#ifdef __linux__
+	pthread_mutex_t Lock;
+#endif
+};
+
+/************************** Function Definitions *****************************/
+static inline void _XAie_DmaBdRingLock(XAie_DmaBdRing *Ring)
+{
+#ifdef __linux__
+	pthread_mutex_lock(&Ring->Lock);
+#else
+	(void)Ring;
+#endif
+}
+
+static inline void _XAie_DmaBdRingUnlock(XAie_DmaBdRing *Ring)
+{
+#ifdef __linux__
+	pthread_mutex_unlock(&Ring->Lock);
+#else
+	(void)Ring;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the BDs of a tile reserved by the existing rings.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+*
+* @return	Mask of the reserved BDs.
+*
+* @note		Internal only. The device lock shall be held.
+*
+*******************************************************************************/
+static u64 _XAie_DmaBdRingGetReserved(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+	u64 Mask = 0U;
+
+	for(XAie_DmaBdRing *R = DevInst->DmaBdRings; R != NULL; R = R->Next) {
+		if((R->Loc.Col == Loc.Col) && (R->Loc.Row == Loc.Row)) {
+			Mask |= R->BdMask;
+		}
+	}
+
+	return Mask;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API gives the BDs of completed tasks back to the ring. The tasks of the
+* ring complete in the order they were queued, so every task beyond the pending
+* BD count of the channel has completed.
+*
+* @param	Ring: BD ring.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The ring lock shall be held. A cyclic chain
+*		never completes and keeps its BDs.
+*
+*******************************************************************************/
+static AieRC _XAie_DmaBdRingRecycle(XAie_DmaBdRing *Ring)
+{
+	AieRC RC;
+	u8 Pending;
+
+	if((Ring->NumTasks == 0U) || (Ring->Cyclic != 0U)) {
+		return XAIE_OK;
+	}
+
+	RC = XAie_DmaGetPendingBdCount(Ring->DevInst, Ring->Loc, Ring->ChNum,
+			Ring->Dir, &Pending);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	while(Ring->NumTasks > Pending) {
+		Ring->Head = (Ring->Head + Ring->TaskLen[Ring->TaskHead]) %
+			Ring->NumBds;
+		Ring->NumUsed -= Ring->TaskLen[Ring->TaskHead];
+		Ring->TaskHead = (Ring->TaskHead + 1U) % Ring->NumBds;
+		Ring->NumTasks--;
+		Ring->NumCompleted++;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a BD ring for a DMA channel. The ring reserves the lowest
+* BDs of the tile which the channel may use and which are not reserved by
+* another ring of the tile.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param	NumBds: Number of BDs to reserve.
+*
+* @return	Pointer to the BD ring on success, NULL on failure.
+*
+* @note		BDs programmed without the ring are not tracked. Applications
+*		mixing both shall create the rings first and avoid the BDs
+*		returned by XAie_DmaBdRingGetBds(). The rings still existing
+*		are destroyed by XAie_Finish().
+*
+*******************************************************************************/
+XAie_DmaBdRing* XAie_DmaBdRingCreate(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir, u8 NumBds)
+{
+	u8 TileType;
+	u32 Token;
+	u64 Reserved;
+	const XAie_DmaMod *DmaMod;
+	XAie_DmaBdRing *Ring;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return NULL;
+	}
+
+	if(Dir >= DMA_MAX) {
+		XAIE_ERROR("Invalid DMA direction\n");
+		return NULL;
+	}
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if((TileType >= XAIEGBL_TILE_TYPE_MAX) ||
+			(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return NULL;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	if(ChNum >= DmaMod->NumChannels) {
+		XAIE_ERROR("Invalid Channel number\n");
+		return NULL;
+	}
+
+	if((NumBds == 0U) || (NumBds > DmaMod->NumBds) ||
+			(NumBds > XAIE_DMA_BDRING_MAX_BDS)) {
+		XAIE_ERROR("Invalid number of BDs\n");
+		return NULL;
+	}
+
+	Ring = (XAie_DmaBdRing *)calloc(1U, sizeof(*Ring));
+	if(Ring == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return NULL;
+	}
+
+#ifdef __linux__
+	if(pthread_mutex_init(&Ring->Lock, NULL) != 0) {
+		XAIE_ERROR("Failed to initialize BD ring lock\n");
+		free(Ring);
+		return NULL;
+	}
+#endif
+
+	Ring->DevInst = DevInst;
+	Ring->DmaMod = DmaMod;
+	Ring->Loc = Loc;
+	Ring->Dir = Dir;
+	Ring->ChNum = ChNum;
+	Ring->TileType = TileType;
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	Reserved = _XAie_DmaBdRingGetReserved(DevInst, Loc);
+	for(u8 Bd = 0U; (Bd < DmaMod->NumBds) &&
+			(Bd < XAIE_DMA_BDRING_MAX_BDS) &&
+			(Ring->NumBds < NumBds); Bd++) {
+		if(((Reserved & (1ULL << Bd)) != 0U) ||
+				(DmaMod->BdChValidity(Bd, ChNum) != XAIE_OK)) {
+			continue;
+		}
+
+		Ring->Bds[Ring->NumBds++] = Bd;
+		Ring->BdMask |= 1ULL << Bd;
+	}
+
+	if(Ring->NumBds < NumBds) {
+		_XAie_SyncRelease(DevInst, Token);
+		XAIE_ERROR("Only %d free BDs for the channel\n", Ring->NumBds);
+#ifdef __linux__
+		pthread_mutex_destroy(&Ring->Lock);
+#endif
+		free(Ring);
+		return NULL;
+	}
+
+	Ring->Next = DevInst->DmaBdRings;
+	DevInst->DmaBdRings = Ring;
+	_XAie_SyncRelease(DevInst, Token);
+
+	return Ring;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API destroys a BD ring and releases its BDs.
+*
+* @param	Ring: BD ring.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The channel shall not be processing tasks of the ring. The BDs
+*		are not reset.
+*
+*******************************************************************************/
+AieRC XAie_DmaBdRingDestroy(XAie_DmaBdRing *Ring)
+{
+	XAie_DevInst *DevInst;
+	u32 Token;
+
+	if((Ring == XAIE_NULL) ||
+			(Ring->DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid BD ring\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	DevInst = Ring->DevInst;
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	for(XAie_DmaBdRing **R = &DevInst->DmaBdRings; *R != NULL;
+			R = &(*R)->Next) {
+		if(*R == Ring) {
+			*R = Ring->Next;
+			break;
+		}
+	}
+	_XAie_SyncRelease(DevInst, Token);
+
+#ifdef __linux__
+	pthread_mutex_destroy(&Ring->Lock);
+#endif
+	free(Ring);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API destroys the BD rings of a device instance.
+*
+* @param	DevInst: Device Instance
+*
+* @return	None.
+*
+* @note		Internal only. Called when the device instance is finished.
+*
+*******************************************************************************/
+void _XAie_DmaBdRingFreeAll(XAie_DevInst *DevInst)
+{
+	XAie_DmaBdRing *Ring = DevInst->DmaBdRings;
+
+	while(Ring != NULL) {
+		XAie_DmaBdRing *Next = Ring->Next;
+
+#ifdef __linux__
+		pthread_mutex_destroy(&Ring->Lock);
+#endif
+		free(Ring);
+		Ring = Next;
+	}
+
+	DevInst->DmaBdRings = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the descriptors of a task to the next free BDs of a ring and
+* pushes the task to the channel queue.
+*
+* @param	Ring: BD ring.
+* @param	Descs: Array of initialized Dma Descriptors of the task.
+* @param	Count: Number of descriptors of the task.
+* @param	Cyclic: XAIE_ENABLE to chain the last BD back to the first one.
+* @param	FirstBd: Pointer to return the first BD of the task. Optional.
+* @param	Seq: Pointer to return the sequence number of the task. Optional.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the ring has no room for the
+*		task, error code on other failures.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_DmaBdRingSubmit(XAie_DmaBdRing *Ring,
+		XAie_DmaDesc *Descs, u8 Count, u8 Cyclic, u8 *FirstBd, u64 *Seq)
+{
+	AieRC RC;
+	u8 Slot, Bd, NextBd, Consecutive = 1U;
+
+	if((Ring == XAIE_NULL) || (Descs == XAIE_NULL) || (Count == 0U) ||
+			(Ring->DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u8 i = 0U; i < Count; i++) {
+		if((Descs[i].IsReady != XAIE_COMPONENT_IS_READY) ||
+				(Descs[i].TileType != Ring->TileType)) {
+			XAIE_ERROR("Invalid Dma Descriptor\n");
+			return XAIE_INVALID_DMA_DESC;
+		}
+	}
+
+	_XAie_DmaBdRingLock(Ring);
+	if(Ring->Cyclic != 0U) {
+		_XAie_DmaBdRingUnlock(Ring);
+		XAIE_ERROR("Ring is running a cyclic task\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_DmaBdRingRecycle(Ring);
+	if(RC != XAIE_OK) {
+		_XAie_DmaBdRingUnlock(Ring);
+		return RC;
+	}
+
+	if((Count > Ring->NumBds - Ring->NumUsed) ||
+			(Ring->NumTasks >= Ring->DmaMod->ChProp->StartQSizeMax)) {
+		_XAie_DmaBdRingUnlock(Ring);
+		XAIE_DBG("No room in the BD ring for the task\n");
+		return XAIE_ERR;
+	}
+
+	Slot = (Ring->Head + Ring->NumUsed) % Ring->NumBds;
+	for(u8 i = 0U; i < Count; i++) {
+		Bd = Ring->Bds[(Slot + i) % Ring->NumBds];
+		NextBd = Ring->Bds[(Slot + i + 1U) % Ring->NumBds];
+		if(i == Count - 1U) {
+			NextBd = Ring->Bds[Slot];
+		} else if(NextBd != Bd + 1U) {
+			Consecutive = 0U;
+		}
+
+		RC = XAie_DmaSetNextBd(&Descs[i], NextBd,
+				((i < Count - 1U) || (Cyclic != 0U)) ?
+				XAIE_ENABLE : XAIE_DISABLE);
+		if(RC != XAIE_OK) {
+			_XAie_DmaBdRingUnlock(Ring);
+			return RC;
+		}
+	}
+
+	if(Consecutive != 0U) {
+		RC = XAie_DmaWriteBds(Ring->DevInst, Ring->Loc, Ring->Bds[Slot],
+				Descs, Count);
+	} else {
+		for(u8 i = 0U; i < Count; i++) {
+			RC = XAie_DmaWriteBd(Ring->DevInst, &Descs[i], Ring->Loc,
+					Ring->Bds[(Slot + i) % Ring->NumBds]);
+			if(RC != XAIE_OK) {
+				break;
+			}
+		}
+	}
+	if(RC != XAIE_OK) {
+		_XAie_DmaBdRingUnlock(Ring);
+		XAIE_ERROR("Failed to write BDs of the task\n");
+		return RC;
+	}
+
+	RC = XAie_DmaChannelPushBdToQueue(Ring->DevInst, Ring->Loc,
+			Ring->ChNum, Ring->Dir, Ring->Bds[Slot]);
+	if(RC != XAIE_OK) {
+		_XAie_DmaBdRingUnlock(Ring);
+		XAIE_ERROR("Failed to push the task to the channel queue\n");
+		return RC;
+	}
+
+	Ring->TaskLen[(Ring->TaskHead + Ring->NumTasks) % Ring->NumBds] =
+		Count;
+	Ring->NumTasks++;
+	Ring->NumUsed += Count;
+	Ring->Cyclic = (Cyclic != 0U) ? 1U : 0U;
+	if(FirstBd != XAIE_NULL) {
+		*FirstBd = Ring->Bds[Slot];
+	}
+	if(Seq != XAIE_NULL) {
+		*Seq = Ring->NumSubmitted;
+	}
+	Ring->NumSubmitted++;
+	_XAie_DmaBdRingUnlock(Ring);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits a task to the channel of a BD ring. The descriptors are
+* written to the next free BDs of the ring, each one chained to the next with
+* its next BD field, and the first BD is pushed to the task queue of the
+* channel.
+*
+* @param	Ring: BD ring.
+* @param	Descs: Array of initialized Dma Descriptors of the task.
+* @param	Count: Number of descriptors of the task.
+* @param	Cyclic: XAIE_ENABLE to chain the last BD back to the first one,
+*		XAIE_DISABLE to end the task with the last BD.
+* @param	FirstBd: Pointer to return the first BD of the task. Optional.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the ring has no room for the
+*		task, error code on other failures.
+*
+* @note		The next BD fields of the descriptors are overwritten. The locks
+*		set in the descriptors are kept, so a cyclic task of N
+*		descriptors acquiring and releasing the buffer locks implements
+*		N-buffering. A cyclic task never completes, no more tasks can
+*		be submitted to the ring after it.
+*		The channel shall be enabled by the application.
+*
+*******************************************************************************/
+AieRC XAie_DmaBdRingSubmit(XAie_DmaBdRing *Ring, XAie_DmaDesc *Descs,
+		u8 Count, u8 Cyclic, u8 *FirstBd)
+{
+	return _XAie_DmaBdRingSubmit(Ring, Descs, Count, Cyclic, FirstBd,
+			XAIE_NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns how many single BD tasks can be submitted to a BD ring
+* without waiting. The BDs of completed tasks are given back to the ring
+* first.
+*
+* @param	Ring: BD ring.
+* @param	NumFree: Pointer to return the number of tasks.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The number is also limited by the depth of the task queue of
+*		the channel.
+*
+*******************************************************************************/
+AieRC XAie_DmaBdRingGetNumFree(XAie_DmaBdRing *Ring, u8 *NumFree)
+{
+	AieRC RC;
+	u8 FreeBds, FreeTasks;
+
+	if((Ring == XAIE_NULL) || (NumFree == XAIE_NULL)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_DmaBdRingLock(Ring);
+	RC = _XAie_DmaBdRingRecycle(Ring);
+	if(RC != XAIE_OK) {
+		_XAie_DmaBdRingUnlock(Ring);
+		return RC;
+	}
+
+	if(Ring->Cyclic != 0U) {
+		*NumFree = 0U;
+	} else {
+		FreeBds = Ring->NumBds - Ring->NumUsed;
+		FreeTasks = Ring->DmaMod->ChProp->StartQSizeMax -
+			Ring->NumTasks;
+		*NumFree = (FreeBds < FreeTasks) ? FreeBds : FreeTasks;
+	}
+	_XAie_DmaBdRingUnlock(Ring);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the BDs reserved by a BD ring.
+*
+* @param	Ring: BD ring.
+* @param	Bds: Array to return the BD numbers. It shall hold as many
+*		entries as the number of BDs of the ring.
+* @param	NumBds: Pointer to return the number of BDs of the ring.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_DmaBdRingGetBds(XAie_DmaBdRing *Ring, u8 *Bds, u8 *NumBds)
+{
+	if((Ring == XAIE_NULL) || (Bds == XAIE_NULL) ||
+			(NumBds == XAIE_NULL)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u8 i = 0U; i < Ring->NumBds; i++) {
+		Bds[i] = Ring->Bds[i];
+	}
+	*NumBds = Ring->NumBds;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits a task to the channel of a BD ring and returns a handle to
+* track its completion without blocking.
+*
+* @param	Ring: BD ring.
+* @param	Descs: Array of initialized Dma Descriptors of the task.
+* @param	Count: Number of descriptors of the task.
+* @param	Task: Pointer to return the handle of the task.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the ring has no room for the
+*		task, error code on other failures.
+*
+* @note		Completion is detected from the pending BD count of the
+*		channel, so tasks pushed to the channel without the ring shall
+*		not be interleaved with tasks of the ring.
+*
+*******************************************************************************/
+AieRC XAie_DmaTaskSubmit(XAie_DmaBdRing *Ring, XAie_DmaDesc *Descs,
+		u8 Count, XAie_DmaTask *Task)
+{
+	AieRC RC;
+
+	if(Task == XAIE_NULL) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_DmaBdRingSubmit(Ring, Descs, Count, XAIE_DISABLE,
+			XAIE_NULL, &Task->Seq);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Task->Ring = Ring;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a task has completed.
+*
+* @param	Task: Handle of the task.
+* @param	Done: Pointer to return 1 if the task has completed, 0
+*		otherwise.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The channel status is only read if the task was not known to
+*		have completed already.
+*
+*******************************************************************************/
+AieRC XAie_DmaTaskPoll(XAie_DmaTask *Task, u8 *Done)
+{
+	AieRC RC = XAIE_OK;
+	XAie_DmaBdRing *Ring;
+
+	if((Task == XAIE_NULL) || (Task->Ring == XAIE_NULL) ||
+			(Done == XAIE_NULL)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Ring = Task->Ring;
+	_XAie_DmaBdRingLock(Ring);
+	if(Task->Seq >= Ring->NumSubmitted) {
+		_XAie_DmaBdRingUnlock(Ring);
+		XAIE_ERROR("Invalid task handle\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Task->Seq >= Ring->NumCompleted) {
+		RC = _XAie_DmaBdRingRecycle(Ring);
+	}
+	*Done = (Task->Seq < Ring->NumCompleted) ? 1U : 0U;
+	_XAie_DmaBdRingUnlock(Ring);
+
+	return RC;
+}
+
+/* Tasks polled by XAie_DmaTaskWaitAny() and XAie_DmaTaskWaitAll() */
+typedef struct {
+	XAie_DmaTask *Tasks;
+	u32 NumTasks;
+	u32 Index;	/* First task not known to have completed */
+	u8 All;
+} XAie_DmaTaskWait;
+
+/*****************************************************************************/
+/**
+*
+* This API is the poll condition of the task wait APIs. When waiting for all
+* tasks, the tasks are checked in order and the first pending one ends the
+* check, so each poll reads a single channel status.
+*
+* @param	Priv: Tasks to be checked.
+* @param	Done: Pointer to return 1 if the wait condition is met.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_DmaTaskWaitCheck(void *Priv, u8 *Done)
+{
+	AieRC RC;
+	u8 TaskDone;
+	XAie_DmaTaskWait *Wait = (XAie_DmaTaskWait *)Priv;
+
+	for(u32 i = (Wait->All != 0U) ? Wait->Index : 0U;
+			i < Wait->NumTasks; i++) {
+		RC = XAie_DmaTaskPoll(&Wait->Tasks[i], &TaskDone);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		/* Stop at the first pending task or the first completed one */
+		if(TaskDone != Wait->All) {
+			Wait->Index = i;
+			*Done = TaskDone;
+			return XAIE_OK;
+		}
+	}
+
+	*Done = (Wait->All != 0U) ? 1U : 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits until any task of a set has completed.
+*
+* @param	Tasks: Array of task handles. The tasks may belong to different
+*		rings of the same device instance.
+* @param	NumTasks: Number of tasks.
+* @param	TimeOutUs: Minimum timeout value in micro seconds.
+* @param	Index: Pointer to return the index of a completed task.
+*
+* @return	XAIE_OK on success, XAIE_TIMEOUT on timeout, error code on
+*		other failures.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_DmaTaskWaitAny(XAie_DmaTask *Tasks, u32 NumTasks, u32 TimeOutUs,
+		u32 *Index)
+{
+	AieRC RC;
+	XAie_DmaTaskWait Wait;
+
+	if((Tasks == XAIE_NULL) || (NumTasks == 0U) || (Index == XAIE_NULL) ||
+			(Tasks[0U].Ring == XAIE_NULL)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Wait.Tasks = Tasks;
+	Wait.NumTasks = NumTasks;
+	Wait.Index = 0U;
+	Wait.All = 0U;
+
+	RC = _XAie_PollCondition(&Tasks[0U].Ring->DevInst->Poll,
+			_XAie_DmaTaskWaitCheck, &Wait, TimeOutUs);
+	if(RC == XAIE_OK) {
+		*Index = Wait.Index;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits until all tasks of a set have completed.
+*
+* @param	Tasks: Array of task handles. The tasks may belong to different
+*		rings of the same device instance.
+* @param	NumTasks: Number of tasks.
+* @param	TimeOutUs: Minimum timeout value in micro seconds.
+*
+* @return	XAIE_OK on success, XAIE_TIMEOUT on timeout, error code on
+*		other failures.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_DmaTaskWaitAll(XAie_DmaTask *Tasks, u32 NumTasks, u32 TimeOutUs)
+{
+	XAie_DmaTaskWait Wait;
+
+	if((Tasks == XAIE_NULL) || (NumTasks == 0U) ||
+			(Tasks[0U].Ring == XAIE_NULL)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Wait.Tasks = Tasks;
+	Wait.NumTasks = NumTasks;
+	Wait.Index = 0U;
+	Wait.All = 1U;
+
+	return _XAie_PollCondition(&Tasks[0U].Ring->DevInst->Poll,
+			_XAie_DmaTaskWaitCheck, &Wait, TimeOutUs);
+}
+
+/** @} */
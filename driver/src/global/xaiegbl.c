@@ -32,9 +32,16 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include "xaie_core.h"
+#include "xaie_dma.h"
+#include "xaie_dma_ring.h"
+#include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_io.h"
 #include "xaie_rsc_internal.h"
+#include "xaie_shadow.h"
+#include "xaie_sync.h"
+#include "xaie_txn_parallel.h"
 #include "xaiegbl.h"
 #include "xaiegbl_defs.h"
 #include "xaiegbl_regdef.h"
@@ -45,6 +52,7 @@
 
 /**************************** Macro Definitions ******************************/
 #define XAIE_ECC_BROADCAST_ID		6U
+#define XAIE_WAIT_MAX_RUN_WORDS		16U	/* Words of one status block read */
 
 /************************** Variable Definitions *****************************/
 extern XAie_TileMod AieMod[XAIEGBL_TILE_TYPE_MAX];
@@ -184,6 +192,18 @@ AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr)
 	InstPtr->AieTileNumRows = ConfigPtr->AieTileNumRows;
 	InstPtr->EccStatus = XAIE_ENABLE;
 	InstPtr->TxnList.Next = NULL;
+	for(u32 i = 0U; i < XAIE_TXN_HASH_BUCKETS; i++) {
+		InstPtr->TxnHash[i].Next = NULL;
+	}
+	InstPtr->ShadowCache = NULL;
+	InstPtr->Sync = NULL;
+	InstPtr->TxnCustomOps = NULL;
+	InstPtr->DmaBdRings = NULL;
+	InstPtr->TxnPool = NULL;
+	InstPtr->Poll.Config.SpinUs = XAIE_POLL_DEFAULT_SPIN_US;
+	InstPtr->Poll.Config.BackoffMinUs = XAIE_POLL_DEFAULT_BACKOFF_MIN_US;
+	InstPtr->Poll.Config.BackoffMaxUs = XAIE_POLL_DEFAULT_BACKOFF_MAX_US;
+	memset(&InstPtr->Poll.Stats, 0, sizeof(InstPtr->Poll.Stats));
 
 	RC = _XAie_RscMgrInit(InstPtr);
 	if(RC != XAIE_OK) {
@@ -369,6 +389,11 @@ AieRC XAie_Finish(XAie_DevInst *DevInst)
 
 	/* Free transaction mode resources, if any */
 	_XAie_TxnResourceCleanup(DevInst);
+	_XAie_ShadowFree(DevInst);
+	_XAie_TxnCustomOpsFree(DevInst);
+	_XAie_DmaBdRingFreeAll(DevInst);
+	_XAie_TxnPoolFree(DevInst);
+	_XAie_SyncFree(DevInst);
 
 	CurrBackend = DevInst->Backend;
 	RC = CurrBackend->Ops.Finish(DevInst->IOInst);
@@ -438,6 +463,7 @@ AieRC XAie_SetIOBackend(XAie_DevInst *DevInst, XAie_BackendType Backend)
 
 	XAIE_DBG("Switching backend to %d\n", Backend);
 	DevInst->Backend = NewBackend;
+	_XAie_ShadowInvalidate(DevInst);
 
 	return XAIE_OK;
 }
@@ -780,6 +806,8 @@ AieRC XAie_TurnEccOn(XAie_DevInst *DevInst)
 * @param	DevInst - Device instance pointer.
 * @param	Flags - Flags passed by the user.
 *			XAIE_TRANSACTION_ENABLE/DISBALE_AUTO_FLUSH
+*			XAIE_TRANSACTION_ENABLE_COALESCING
+*			XAIE_TRANSACTION_ENABLE_COLUMN_PARALLEL
 *
 * @return	XAIE_OK on success and error code on failure.
 *
@@ -791,6 +819,16 @@ AieRC XAie_TurnEccOn(XAie_DevInst *DevInst)
 *		operation. In both cases, the user has to call
 *		XAie_SubmitTransaction API to flush all the pending IO
 *		operations stored in the command buffer.
+*		If the ENABLE_COALESCING flag is set, writes to consecutive
+*		registers of a tile are recorded as a single block write and
+*		back to back mask writes to disjoint bits of the same register
+*		are folded together. Only adjacent commands are merged, so the
+*		order of operations around a MaskPoll is preserved.
+*		If the ENABLE_COLUMN_PARALLEL flag is set, the commands are
+*		split by column when the transaction is flushed to a memory
+*		mapped backend and the columns are configured from a pool of
+*		worker threads. Commands of a column keep their order, MaskPoll
+*		and custom operations wait for all the preceding commands.
 *
 ******************************************************************************/
 AieRC XAie_StartTransaction(XAie_DevInst *DevInst, u32 Flags)
@@ -887,6 +925,67 @@ AieRC XAie_FreeTransactionInstance(XAie_TxnInst *TxnInst)
 	return _XAie_TxnFree(TxnInst);
 }
 
+/*****************************************************************************/
+/**
+*
+* This api marks a register field written by an exported transaction instance
+* as a patch point. The field can then be updated with XAie_TxnPatch before
+* each submission of the instance, without recording the transaction again.
+*
+* @param	TxnInst - Exported transaction instance.
+* @param	RegOff - Partition relative offset of the register.
+* @param	Mask - Mask of the field within the register.
+* @param	Shift - Number of bits the patch value is shifted right by
+*		before it is placed at the lowest bit of Mask.
+* @param	Slot - Pointer to return the patch point index.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The last command of the instance writing RegOff is patched. The
+*		register must be written by a write, a block write or a mask
+*		write covering Mask. As an example, the lower and upper words of
+*		a shim DMA buffer address can be patched from the same 64-bit
+*		address with two patch points using shifts of the field lsb and
+*		32 respectively.
+*
+******************************************************************************/
+AieRC XAie_TxnAddPatchPoint(XAie_TxnInst *TxnInst, u64 RegOff, u32 Mask,
+		u8 Shift, u32 *Slot)
+{
+	if((TxnInst == NULL) || (Slot == NULL) || (Mask == 0U) ||
+			(Shift >= 64U) || ((RegOff & 0x3U) != 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnAddPatchPoint(TxnInst, RegOff, Mask, Shift, Slot);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api updates a patch point of an exported transaction instance.
+*
+* @param	TxnInst - Exported transaction instance.
+* @param	Slot - Patch point index returned by XAie_TxnAddPatchPoint.
+* @param	Value - New value of the field.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Value is shifted right by the shift of the patch point, bits
+*		which do not fit in the field after the shift are dropped.
+*
+******************************************************************************/
+AieRC XAie_TxnPatch(XAie_TxnInst *TxnInst, u32 Slot, u64 Value)
+{
+	if(TxnInst == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnPatch(TxnInst, Slot, Value);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -955,6 +1054,41 @@ u8* XAie_ExportSerializedTransaction(XAie_DevInst *DevInst,
 	return _XAie_TxnExportSerialized(DevInst, NumConsumers, Flags);
 }
 
+/*****************************************************************************/
+/**
+*
+* This api serializes the transaction of the calling thread and writes it to a
+* file descriptor. The output is identical to the buffer returned by
+* XAie_ExportSerializedTransaction, but it is streamed through a fixed size
+* buffer instead of being built in memory.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Fd - File descriptor opened for writing. It can be a file, a
+*		pipe or a socket.
+* @param	NumConsumers - Number of consumers for the generated
+*		transactions (Unused for now)
+* @param	Flags - Flags (Unused for now)
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The file descriptor is not closed. On failure, a partial
+*		transaction may have been written.
+*		Only supported on Linux, other platforms return
+*		XAIE_FEATURE_NOT_SUPPORTED.
+*
+******************************************************************************/
+AieRC XAie_ExportSerializedTransactionToFd(XAie_DevInst *DevInst, int Fd,
+		u8 NumConsumers, u32 Flags)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY) || (Fd < 0)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnExportSerializedToFd(DevInst, Fd, NumConsumers, Flags);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -977,6 +1111,74 @@ void XAie_FreeSerializedTransaction(void *Ptr)
 	_XAie_FreeTxnPtr(Ptr);
 }
 
+/*****************************************************************************/
+/**
+*
+* This api imports a serialized transaction buffer, generated by
+* XAie_ExportSerializedTransaction, and converts it back to a transaction
+* instance. The header of the buffer is validated against the device
+* generation, partition geometry and the supported transaction versions.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnPtr - Pointer to the serialized transaction buffer.
+* @param	BufSize - Size of the serialized transaction buffer in bytes.
+*		The size recorded in the buffer header must not exceed it.
+*
+* @return	Pointer to transaction instance on success and NULL on error.
+*
+* @note		The returned instance is treated as an exported instance. It
+*		can be submitted multiple times using XAie_SubmitTransaction
+*		and must be freed using XAie_FreeTransactionInstance. The
+*		serialized buffer is not referenced after this api returns.
+*
+******************************************************************************/
+XAie_TxnInst* XAie_ImportSerializedTransaction(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 BufSize)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+		(TxnPtr == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return NULL;
+	}
+
+	return _XAie_TxnImportSerialized(DevInst, TxnPtr, BufSize);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api replays a serialized transaction buffer, generated by
+* XAie_ExportSerializedTransaction, on the device instance. The operations are
+* decoded in place and issued to the IO backend in order.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnPtr - Pointer to the serialized transaction buffer.
+* @param	BufSize - Size of the serialized transaction buffer in bytes.
+*		The size recorded in the buffer header must not exceed it.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The operations are issued directly to the IO backend even if a
+*		transaction was started from the calling context. To batch the
+*		operations through the backend transaction interface, import
+*		the buffer with XAie_ImportSerializedTransaction and submit the
+*		returned instance.
+*
+******************************************************************************/
+AieRC XAie_ExecuteSerializedTransaction(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 BufSize)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+		(TxnPtr == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_TxnExecuteSerialized(DevInst, TxnPtr, BufSize);
+}
+
 AieRC XAie_ClearTransaction(XAie_DevInst* DevInst)
 {
 	if((DevInst == XAIE_NULL) ||
@@ -988,4 +1190,571 @@ AieRC XAie_ClearTransaction(XAie_DevInst* DevInst)
 	return _XAie_ClearTransaction(DevInst);
 }
 
+/*****************************************************************************/
+/**
+*
+* This api enables the shadow register cache of the device instance. Once
+* enabled, the driver remembers the values written to the static configuration
+* registers of the partition, such as stream switch ports, DMA buffer
+* descriptors and channel controls, event broadcasts and trace controls.
+* Writes of a value the register already holds are dropped and masked writes
+* are computed from the cached value instead of reading the register back.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The cache is dropped on partition reset, initialization and
+*		teardown, on backend switch and whenever a transaction is
+*		flushed or replayed. If the registers are modified by any other
+*		agent, such as another device instance of the same partition or
+*		firmware, XAie_InvalidateShadowCache must be called before the
+*		next write.
+*
+******************************************************************************/
+AieRC XAie_EnableShadowCache(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_ShadowEnable(DevInst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api disables the shadow register cache of the device instance and
+* releases its memory.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_DisableShadowCache(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_ShadowFree(DevInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api drops all the register values held by the shadow register cache of
+* the device instance. The next write to every register is issued to the
+* device.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_InvalidateShadowCache(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_ShadowInvalidate(DevInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api makes the device instance safe to use from multiple threads. Once
+* enabled, the register accesses, backend operations, resource requests and
+* transactions of the device instance can be issued from any thread without
+* external locking.
+*
+* Register accesses are serialized per column: threads configuring disjoint
+* sets of columns run in parallel, accesses to the same column are issued one
+* at a time. Backend operations, resource manager requests, transaction
+* flushes and accesses spanning more than one column are serialized against
+* all the other accesses of the device instance. Each thread records its own
+* transaction, recording does not take any lock.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The locks are only available in Linux builds of the driver. On
+*		other platforms, including baremetal applications, the api fails
+*		with XAIE_FEATURE_NOT_SUPPORTED and the device instance must be
+*		used from a single thread.
+*		In Linux builds, register accesses of the Linux kernel, libmetal
+*		and baremetal backends are sharded by column. The accesses of all
+*		the other backends, and all the accesses while the shadow register
+*		cache is enabled, are serialized by the device lock.
+*		Initialization, teardown, backend switch and the enable and
+*		disable APIs of the device instance must not be called
+*		concurrently with any other API.
+*
+******************************************************************************/
+AieRC XAie_EnableThreadSafety(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_SyncEnable(DevInst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api releases the locks of the device instance. The device instance must
+* only be used from a single thread afterwards.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		No other thread may be using the device instance.
+*
+******************************************************************************/
+AieRC XAie_DisableThreadSafety(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_SyncFree(DevInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api waits for the register writes issued on the device instance to be
+* submitted to the device. The Linux kernel backend buffers the register
+* writes and submits them with a single ioctl when the buffer is full or
+* before any read, poll or backend operation. The socket backend buffers the
+* writes of its binary protocol. The CDO backend buffers the register writes
+* if enabled with XAie_CdoSetBuffering. This api submits the buffered writes
+* without issuing any other access.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Register writes of the other backends are issued to the device
+*		immediately and this api returns XAIE_OK for them. Writes
+*		recorded in a transaction are not affected.
+*
+******************************************************************************/
+AieRC XAie_FlushWrites(XAie_DevInst *DevInst)
+{
+	AieRC RC;
+	u32 Token;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	RC = DevInst->Backend->Ops.RunOp(DevInst->IOInst, DevInst,
+			XAIE_BACKEND_OP_FLUSH_WRITES, NULL);
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api configures the register poll loop of the device instance. Polls
+* read the register back to back for SpinUs micro seconds and then sleep
+* between the reads, starting with BackoffMinUs and doubling the sleep up to
+* BackoffMaxUs. A short spin period lowers the CPU usage of long polls, a long
+* one lowers the completion latency of short polls.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Config - Poll loop configuration.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The configuration applies to the register polls of the Linux,
+*		metal, socket and baremetal backends and to the waits of
+*		XAie_WaitForDoneSet and of the DMA tasks on all backends.
+*
+******************************************************************************/
+AieRC XAie_SetPollConfig(XAie_DevInst *DevInst, const XAie_PollConfig *Config)
+{
+	if((DevInst == XAIE_NULL) || (Config == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Config->BackoffMinUs == 0U) ||
+			(Config->BackoffMaxUs < Config->BackoffMinUs)) {
+		XAIE_ERROR("Invalid poll backoff range %u-%uus\n",
+				Config->BackoffMinUs, Config->BackoffMaxUs);
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Polls in progress pick up each field independently */
+	XAIE_ATOMIC_STORE(&DevInst->Poll.Config.SpinUs, Config->SpinUs);
+	XAIE_ATOMIC_STORE(&DevInst->Poll.Config.BackoffMinUs,
+			Config->BackoffMinUs);
+	XAIE_ATOMIC_STORE(&DevInst->Poll.Config.BackoffMaxUs,
+			Config->BackoffMaxUs);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api returns the latency counters of the register polls issued on the
+* device instance since its initialization or the last reset of the counters.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Stats - Pointer to return the counters.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Polls of different columns update the counters concurrently
+*		when thread safety is enabled. Each counter is read
+*		atomically, the counters of polls completing during the call
+*		may be partially included.
+*
+******************************************************************************/
+AieRC XAie_GetPollStats(XAie_DevInst *DevInst, XAie_PollStats *Stats)
+{
+	XAie_PollStats *Src;
+
+	if((DevInst == XAIE_NULL) || (Stats == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Src = &DevInst->Poll.Stats;
+	Stats->NumPolls = XAIE_ATOMIC_LOAD(&Src->NumPolls);
+	Stats->NumTimeouts = XAIE_ATOMIC_LOAD(&Src->NumTimeouts);
+	Stats->NumReads = XAIE_ATOMIC_LOAD(&Src->NumReads);
+	Stats->LastUs = XAIE_ATOMIC_LOAD(&Src->LastUs);
+	Stats->MaxUs = XAIE_ATOMIC_LOAD(&Src->MaxUs);
+	Stats->TotalUs = XAIE_ATOMIC_LOAD(&Src->TotalUs);
+	for(u32 i = 0U; i < XAIE_POLL_STATS_NUM_BUCKETS; i++) {
+		Stats->Histogram[i] = XAIE_ATOMIC_LOAD(&Src->Histogram[i]);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api clears the latency counters of the register polls of the device
+* instance.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_ResetPollStats(XAie_DevInst *DevInst)
+{
+	XAie_PollStats *Stats;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Stats = &DevInst->Poll.Stats;
+	XAIE_ATOMIC_STORE(&Stats->NumPolls, 0U);
+	XAIE_ATOMIC_STORE(&Stats->NumTimeouts, 0U);
+	XAIE_ATOMIC_STORE(&Stats->NumReads, 0U);
+	XAIE_ATOMIC_STORE(&Stats->LastUs, 0U);
+	XAIE_ATOMIC_STORE(&Stats->MaxUs, 0U);
+	XAIE_ATOMIC_STORE(&Stats->TotalUs, 0U);
+	for(u32 i = 0U; i < XAIE_POLL_STATS_NUM_BUCKETS; i++) {
+		XAIE_ATOMIC_STORE(&Stats->Histogram[i], 0U);
+	}
+
+	return XAIE_OK;
+}
+
+/* Condition of a target of XAie_WaitForDoneSet() */
+typedef struct {
+	u64 RegAddr;
+	u32 Mask;
+	u32 Value;
+	u32 ErrMask;	/* Bits set once the target failed */
+	u32 Idx;	/* Index of the target */
+	u8 Done;
+} XAie_WaitCond;
+
+/* Targets polled by XAie_WaitForDoneSet(), sorted by register address */
+typedef struct {
+	XAie_DevInst *DevInst;
+	XAie_WaitCond *Conds;
+	u32 NumConds;
+	u32 NumPending;
+	AieRC *Status;
+} XAie_WaitSet;
+
+static int _XAie_WaitCondCompare(const void *A, const void *B)
+{
+	const XAie_WaitCond *CondA = (const XAie_WaitCond *)A;
+	const XAie_WaitCond *CondB = (const XAie_WaitCond *)B;
+
+	if(CondA->RegAddr != CondB->RegAddr) {
+		return (CondA->RegAddr < CondB->RegAddr) ? -1 : 1;
+	}
+
+	return (CondA->Idx < CondB->Idx) ? -1 : 1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks the pending targets of a wait set. Runs of status registers
+* at consecutive addresses are read with one block read, registers which are
+* not part of the set are never read.
+*
+* @param	Priv - Wait set.
+* @param	Done - Pointer to return 1 once all the targets are done.
+*
+* @return	XAIE_OK on success, XAIE_ERR if a target reports an error and
+*		error code of the register read on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_WaitSetCheck(void *Priv, u8 *Done)
+{
+	AieRC RC, Failed = XAIE_OK;
+	u32 Words[XAIE_WAIT_MAX_RUN_WORDS];
+	u32 First, Last, NumWords, Word;
+	u64 Delta;
+	u8 Pending;
+	XAie_WaitSet *Set = (XAie_WaitSet *)Priv;
+	XAie_WaitCond *Conds = Set->Conds;
+
+	for(First = 0U; First < Set->NumConds; First = Last) {
+		Pending = (Conds[First].Done == 0U) ? 1U : 0U;
+		NumWords = 1U;
+		for(Last = First + 1U; Last < Set->NumConds; Last++) {
+			Delta = Conds[Last].RegAddr - Conds[Last - 1U].RegAddr;
+			if((Delta == sizeof(u32)) &&
+					(NumWords < XAIE_WAIT_MAX_RUN_WORDS)) {
+				NumWords++;
+			} else if(Delta != 0U) {
+				break;
+			}
+			Pending |= (Conds[Last].Done == 0U) ? 1U : 0U;
+		}
+
+		if(Pending == 0U) {
+			continue;
+		}
+
+		if(NumWords == 1U) {
+			RC = XAie_Read32(Set->DevInst, Conds[First].RegAddr,
+					&Words[0U]);
+		} else {
+			RC = XAie_BlockRead32(Set->DevInst,
+					Conds[First].RegAddr, Words, NumWords);
+		}
+
+		for(u32 i = First; i < Last; i++) {
+			if(Conds[i].Done != 0U) {
+				continue;
+			}
+
+			if(RC != XAIE_OK) {
+				if(Set->Status != XAIE_NULL) {
+					Set->Status[Conds[i].Idx] = RC;
+				}
+				continue;
+			}
+
+			Word = (u32)((Conds[i].RegAddr - Conds[First].RegAddr) /
+					sizeof(u32));
+			if((Words[Word] & Conds[i].ErrMask) != 0U) {
+				XAIE_ERROR("Wait target %d failed, status "
+						"0x%x\n", Conds[i].Idx,
+						Words[Word]);
+				if(Set->Status != XAIE_NULL) {
+					Set->Status[Conds[i].Idx] = XAIE_ERR;
+				}
+				Failed = XAIE_ERR;
+			} else if((Words[Word] & Conds[i].Mask) ==
+					Conds[i].Value) {
+				Conds[i].Done = 1U;
+				Set->NumPending--;
+				if(Set->Status != XAIE_NULL) {
+					Set->Status[Conds[i].Idx] = XAIE_OK;
+				}
+			}
+		}
+
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to read status of wait targets\n");
+			return RC;
+		}
+	}
+
+	*Done = (Set->NumPending == 0U) ? 1U : 0U;
+
+	return Failed;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api returns the register condition met once a target of a wait set is
+* done. The condition is provided by the module of the target.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Target - DMA channel or core.
+* @param	Cond - Condition to fill.
+*
+* @return	XAIE_OK on success and error code if the target is invalid.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_WaitGetCond(XAie_DevInst *DevInst,
+		const XAie_WaitTarget *Target, XAie_WaitCond *Cond)
+{
+	switch(Target->Type) {
+#ifdef XAIE_FEATURE_DMA_ENABLE
+	case XAIE_WAIT_DMA:
+		return _XAie_DmaGetWaitCond(DevInst, Target->Loc,
+				Target->ChNum, Target->Dir, &Cond->RegAddr,
+				&Cond->Mask, &Cond->Value, &Cond->ErrMask);
+#endif
+#ifdef XAIE_FEATURE_CORE_ENABLE
+	case XAIE_WAIT_CORE:
+		return _XAie_CoreGetWaitCond(DevInst, Target->Loc,
+				&Cond->RegAddr, &Cond->Mask, &Cond->Value,
+				&Cond->ErrMask);
+#endif
+	default:
+		return XAIE_INVALID_ARGS;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This api waits for a set of DMA channels and cores to be done. All the
+* targets are polled in one loop, with the spin and backoff periods of the
+* register poll configuration, instead of waiting for them one after the
+* other.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Targets - Array of DMA channels and cores to wait for.
+* @param	NumTargets - Number of targets.
+* @param	TimeOutUs - Minimum timeout value in micro seconds for the
+*		whole set. The targets are checked at least once.
+* @param	Status - Array of NumTargets entries to return the status of
+*		each target: XAIE_OK if it is done, XAIE_TIMEOUT if it is not
+*		done, XAIE_ERR if it failed, or the error code of a failed
+*		access. Optional.
+*
+* @return	XAIE_OK if all targets are done, XAIE_TIMEOUT if some targets
+*		are not done once the timeout expires, XAIE_ERR if a target
+*		failed, error code if a target is invalid or its status cannot
+*		be read.
+*
+* @note		The call returns as soon as all targets are done, one of them
+*		failed, or the status of one of them cannot be read. A target
+*		fails when its status register reports an error: an error bit
+*		or a task queue overflow of an AIE-ML DMA channel, or the error
+*		halt of an AIE-ML core. AIE devices have no such bits in the
+*		registers which are polled, their targets never fail. A
+*		stalled DMA channel or core is still pending, as stalls on
+*		locks and streams are part of normal operation.
+*
+******************************************************************************/
+AieRC XAie_WaitForDoneSet(XAie_DevInst *DevInst,
+		const XAie_WaitTarget *Targets, u32 NumTargets, u32 TimeOutUs,
+		AieRC *Status)
+{
+	AieRC RC;
+	XAie_WaitSet Set;
+
+	if((DevInst == XAIE_NULL) || (Targets == XAIE_NULL) ||
+			(NumTargets == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Set.Conds = (XAie_WaitCond *)calloc(NumTargets, sizeof(*Set.Conds));
+	if(Set.Conds == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumTargets; i++) {
+		RC = _XAie_WaitGetCond(DevInst, &Targets[i], &Set.Conds[i]);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Invalid wait target %d\n", i);
+			if(Status != XAIE_NULL) {
+				Status[i] = RC;
+			}
+			free(Set.Conds);
+			return RC;
+		}
+
+		Set.Conds[i].Idx = i;
+		if(Status != XAIE_NULL) {
+			Status[i] = XAIE_TIMEOUT;
+		}
+	}
+
+	qsort(Set.Conds, NumTargets, sizeof(*Set.Conds),
+			_XAie_WaitCondCompare);
+
+	Set.DevInst = DevInst;
+	Set.NumConds = NumTargets;
+	Set.NumPending = NumTargets;
+	Set.Status = Status;
+
+	RC = _XAie_PollCondition(&DevInst->Poll, _XAie_WaitSetCheck, &Set,
+			TimeOutUs);
+	if(RC == XAIE_TIMEOUT) {
+		XAIE_DBG("Wait for done timed out\n");
+	}
+
+	free(Set.Conds);
+
+	return RC;
+}
+
 /** @} */
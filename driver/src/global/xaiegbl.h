@@ -51,6 +51,18 @@
 
 #define XAIE_TRANSACTION_ENABLE_AUTO_FLUSH	0b1U
 #define XAIE_TRANSACTION_DISABLE_AUTO_FLUSH	0b0U
+#define XAIE_TRANSACTION_ENABLE_COALESCING	0b100U
+#define XAIE_TRANSACTION_ENABLE_COLUMN_PARALLEL	0b1000U
+
+/* Default register poll loop settings, see XAie_SetPollConfig */
+#define XAIE_POLL_DEFAULT_SPIN_US	20U
+#define XAIE_POLL_DEFAULT_BACKOFF_MIN_US	1U
+#define XAIE_POLL_DEFAULT_BACKOFF_MAX_US	200U
+#define XAIE_POLL_STATS_NUM_BUCKETS	16U
+
+/* Transaction instances are hashed by thread id for O(1) lookup */
+#define XAIE_TXN_HASH_BITS		4U
+#define XAIE_TXN_HASH_BUCKETS		(1U << XAIE_TXN_HASH_BITS)
 
 #define XAIE_PART_INIT_OPT_COLUMN_RST		(1U << 0)
 #define XAIE_PART_INIT_OPT_SHIM_RST		(1U << 1)
@@ -69,7 +81,15 @@ typedef struct XAie_DmaMod XAie_DmaMod;
 typedef struct XAie_LockMod XAie_LockMod;
 typedef struct XAie_Backend XAie_Backend;
 typedef struct XAie_TxnCmd XAie_TxnCmd;
+typedef struct XAie_TxnInst XAie_TxnInst;
+typedef struct XAie_TxnArena XAie_TxnArena;
+typedef struct XAie_TxnPatchPoint XAie_TxnPatchPoint;
+typedef struct XAie_ShadowCache XAie_ShadowCache;
+typedef struct XAie_SyncCtx XAie_SyncCtx;
+typedef struct XAie_TxnCustomOp XAie_TxnCustomOp;
 typedef struct XAie_ResourceManager XAie_ResourceManager;
+typedef struct XAie_DmaBdRing XAie_DmaBdRing;
+typedef struct XAie_TxnPool XAie_TxnPool;
 
 /*
  * This typedef captures all the properties of a AIE Device
@@ -92,6 +112,7 @@ typedef enum {
 	XAIE_IO_BACKEND_DEBUG, /* IO debug backend */
 	XAIE_IO_BACKEND_LINUX, /* Linux kernel backend */
 	XAIE_IO_BACKEND_SOCKET, /* Socket backend */
+	XAIE_IO_BACKEND_REGFILE, /* In memory register file backend */
 	XAIE_IO_BACKEND_MAX
 } XAie_BackendType;
 
@@ -111,6 +132,38 @@ typedef struct {
 			 * is closed. */
 } XAie_PartitionProp;
 
+/*
+ * Settings of the register poll loop. A poll reads the register back to back
+ * for SpinUs, then sleeps for BackoffMinUs doubling the sleep after each read
+ * until it reaches BackoffMaxUs, which is used for the rest of the poll.
+ */
+typedef struct {
+	u32 SpinUs;
+	u32 BackoffMinUs;
+	u32 BackoffMaxUs;
+} XAie_PollConfig;
+
+/*
+ * Latency counters of the register polls and of the waits for DMA and core
+ * completions. NumReads counts the checks of the polled conditions.
+ * Histogram[i] counts the polls which completed in less than 2^i us, the last
+ * bucket counts all the slower ones.
+ */
+typedef struct {
+	u64 NumPolls;
+	u64 NumTimeouts;
+	u64 NumReads;
+	u64 LastUs;
+	u64 MaxUs;
+	u64 TotalUs;
+	u64 Histogram[XAIE_POLL_STATS_NUM_BUCKETS];
+} XAie_PollStats;
+
+typedef struct {
+	XAie_PollConfig Config;
+	XAie_PollStats Stats;
+} XAie_PollCtx;
+
 /* Generic linked list structure */
 typedef struct XAie_List {
 	struct XAie_List *Next;
@@ -140,18 +193,30 @@ typedef struct {
 	XAie_DeviceOps *DevOps; /* Device level operations */
 	XAie_PartitionProp PartProp; /* Partition property */
 	XAie_List TxnList; /* Head of the list of txn buffers */
+	XAie_List TxnHash[XAIE_TXN_HASH_BUCKETS]; /* Txn buffers by thread id */
+	XAie_ShadowCache *ShadowCache; /* Shadow register cache, if enabled */
+	XAie_TxnCustomOp *TxnCustomOps; /* Host handlers of custom txn ops */
+	XAie_PollCtx Poll; /* Register poll settings and statistics */
+	XAie_SyncCtx *Sync; /* Locks of the instance, if thread safe */
+	XAie_DmaBdRing *DmaBdRings; /* BD rings created on the instance */
+	XAie_TxnPool *TxnPool; /* Workers of column parallel transactions */
 } XAie_DevInst;
 
 /* typedef to capture transaction buffer data */
-typedef struct {
+struct XAie_TxnInst {
 	u64 Tid;
 	u32 Flags;
 	u32 NumCmds;
 	u32 MaxCmds;
 	u8  NextCustomOp;
 	XAie_TxnCmd *CmdBuf;
+	XAie_TxnArena *Arena; /* Bump allocator for command payloads */
+	XAie_TxnPatchPoint *PatchPoints; /* Patchable fields of exported txn */
+	u32 NumPatchPoints;
+	u32 MaxPatchPoints;
 	XAie_List Node;
-} XAie_TxnInst;
+	XAie_List HashNode; /* Node in the thread id hash bucket */
+};
 
 /* enum to capture cache property of allocate memory */
 typedef enum {
@@ -359,6 +424,23 @@ typedef struct {
 	u8 IsReady;
 } XAie_DmaDesc;
 
+/*
+ * Encoded buffer descriptor words compiled from a dma descriptor. The image
+ * can be written to any BD of a tile of the same type without encoding the
+ * descriptor again.
+ */
+#define XAIE_DMA_BD_MAX_WORDS	8U
+typedef struct {
+	u32 Words[XAIE_DMA_BD_MAX_WORDS];
+	const XAie_DmaMod *DmaMod;
+	XAie_MemInst *MemInst;
+	u64 Address;	/* Buffer address field as encoded in the BD words */
+	u32 Len;	/* Buffer length in bytes */
+	u8 NumWords;
+	u8 TileType;
+	u8 IsReady;
+} XAie_DmaBdImage;
+
 typedef struct {
 	u32 RepeatCount;
 	u8 StartBd;
@@ -382,6 +464,25 @@ typedef enum {
 	DMA_MAX
 } XAie_DmaDirection;
 
+/*
+ * This enum contains the kinds of targets of XAie_WaitForDoneSet().
+ */
+typedef enum {
+	XAIE_WAIT_DMA,
+	XAIE_WAIT_CORE,
+} XAie_WaitTargetType;
+
+/*
+ * Target of XAie_WaitForDoneSet(). ChNum and Dir are only used for DMA
+ * channels.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	XAie_WaitTargetType Type;
+	u8 ChNum;
+	XAie_DmaDirection Dir;
+} XAie_WaitTarget;
+
 /*
  * This enum contains the FoT mode for aie Dma Channel.
  */
@@ -429,9 +530,66 @@ typedef enum{
 	XAIE_INVALID_BURST_LENGTH,
 	XAIE_INVALID_BACKEND,
 	XAIE_INSUFFICIENT_BUFFER_SIZE,
+	XAIE_TIMEOUT,
 	XAIE_ERR_MAX
 } AieRC;
 
+/*
+ * Callback executing a custom transaction operation on the host. Args and Size
+ * are the arguments recorded with XAie_AddCustomTxnOp and Priv is the pointer
+ * passed when the handler was registered.
+ */
+typedef AieRC (*XAie_TxnCustomOpHandler)(XAie_DevInst *DevInst, u8 OpNumber,
+		void *Args, u32 Size, void *Priv);
+
+/*
+ * Access hook of the register file backend. Called with the register offset
+ * and a pointer to the stored value after every write (IsWrite set) and before
+ * every read of a register.
+ */
+typedef void (*XAie_RegFileHook)(void *Priv, u64 RegOff, u32 *Value,
+		u8 IsWrite);
+
+/*
+ * IO backend calls recorded by the IO trace.
+ */
+typedef enum {
+	XAIE_IOTRACE_OP_WRITE32,
+	XAIE_IOTRACE_OP_READ32,
+	XAIE_IOTRACE_OP_MASKWRITE32,
+	XAIE_IOTRACE_OP_MASKPOLL,
+	XAIE_IOTRACE_OP_BLOCKWRITE32,
+	XAIE_IOTRACE_OP_BLOCKSET32,
+	XAIE_IOTRACE_OP_CMDWRITE,
+	XAIE_IOTRACE_OP_RUNOP,
+	XAIE_IOTRACE_OP_SUBMITTXN,
+	XAIE_IOTRACE_OP_BLOCKREAD32,
+	XAIE_IOTRACE_OP_MAX
+} XAie_IOTraceOp;
+
+/*
+ * Statistics of an IO trace replay, indexed by XAie_IOTraceOp.
+ */
+typedef struct {
+	u64 NumOps;		/* Records in the trace */
+	u64 NumSkipped;		/* Records which cannot be replayed */
+	u64 NumMismatches;	/* Reads and polls with a different result */
+	u64 OpCount[XAIE_IOTRACE_OP_MAX];
+	u64 OpTotalNs[XAIE_IOTRACE_OP_MAX];	/* Time spent in the backend */
+	u64 TraceTotalNs[XAIE_IOTRACE_OP_MAX];	/* Time of the recording */
+} XAie_IOTraceStats;
+
+/*
+ * Statistics of the commands emitted by the CDO backend.
+ */
+typedef struct {
+	u64 NumOps;		/* CDO commands emitted */
+	u64 NumBytes;		/* Encoded size of the emitted commands */
+	u64 NumWrites;		/* Register writes received by the backend */
+	u64 NumMerged;		/* Writes merged into the previous block write */
+	u64 NumDropped;		/* Writes dropped as overwritten */
+} XAie_CdoStats;
+
 /*
  * This enum is to identify different hardware modules within a tile type.
  * An AIE tile can have memory or core module. A PL or Shim tile will have
@@ -550,6 +708,17 @@ typedef struct {
 	uint32_t Size;
 } XAie_BlockWrite32Hdr;
 
+/* Fills Count consecutive registers with Value, available from version 0.2 */
+typedef struct {
+	XAie_OpHdr OpHdr;
+	uint8_t Col;
+	uint8_t Row;
+	uint32_t RegOff;
+	uint32_t Value;
+	uint32_t Count;
+	uint32_t Size;
+} XAie_BlockSet32Hdr;
+
 typedef struct {
 	XAie_OpHdr OpHdr;
 	uint32_t Size;
@@ -581,8 +750,38 @@ AieRC XAie_SubmitTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
 XAie_TxnInst* XAie_ExportTransactionInstance(XAie_DevInst *DevInst);
 u8* XAie_ExportSerializedTransaction(XAie_DevInst *DevInst,
 		u8 NumConsumers, u32 Flags);
+AieRC XAie_ExportSerializedTransactionToFd(XAie_DevInst *DevInst, int Fd,
+		u8 NumConsumers, u32 Flags);
+void XAie_FreeSerializedTransaction(void *Ptr);
+XAie_TxnInst* XAie_ImportSerializedTransaction(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 BufSize);
+AieRC XAie_ExecuteSerializedTransaction(XAie_DevInst *DevInst,
+		const u8 *TxnPtr, u32 BufSize);
 AieRC XAie_FreeTransactionInstance(XAie_TxnInst *TxnInst);
+AieRC XAie_TxnAddPatchPoint(XAie_TxnInst *TxnInst, u64 RegOff, u32 Mask,
+		u8 Shift, u32 *Slot);
+AieRC XAie_TxnPatch(XAie_TxnInst *TxnInst, u32 Slot, u64 Value);
 AieRC XAie_ClearTransaction(XAie_DevInst* DevInst);
+AieRC XAie_EnableShadowCache(XAie_DevInst *DevInst);
+AieRC XAie_DisableShadowCache(XAie_DevInst *DevInst);
+AieRC XAie_InvalidateShadowCache(XAie_DevInst *DevInst);
+AieRC XAie_EnableThreadSafety(XAie_DevInst *DevInst);
+AieRC XAie_DisableThreadSafety(XAie_DevInst *DevInst);
+AieRC XAie_FlushWrites(XAie_DevInst *DevInst);
+AieRC XAie_RegFileSetHook(XAie_DevInst *DevInst, XAie_RegFileHook Hook,
+		void *Priv);
+AieRC XAie_CdoSetBuffering(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_CdoGetStats(XAie_DevInst *DevInst, XAie_CdoStats *Stats);
+AieRC XAie_IOTraceStart(XAie_DevInst *DevInst, const char *Path);
+AieRC XAie_IOTraceStop(XAie_DevInst *DevInst);
+AieRC XAie_IOTraceReplay(XAie_DevInst *DevInst, const char *Path, u8 Paced,
+		XAie_IOTraceStats *Stats);
+AieRC XAie_SetPollConfig(XAie_DevInst *DevInst, const XAie_PollConfig *Config);
+AieRC XAie_GetPollStats(XAie_DevInst *DevInst, XAie_PollStats *Stats);
+AieRC XAie_ResetPollStats(XAie_DevInst *DevInst);
+AieRC XAie_WaitForDoneSet(XAie_DevInst *DevInst,
+		const XAie_WaitTarget *Targets, u32 NumTargets, u32 TimeOutUs,
+		AieRC *Status);
 AieRC XAie_IsDeviceCheckerboard(XAie_DevInst *DevInst, u8 *IsCheckerBoard);
 AieRC XAie_UpdateNpiAddr(XAie_DevInst *DevInst, u64 NpiAddr);
 AieRC XAie_MapIrqIdToCols(u8 IrqId, XAie_Range *Range);
@@ -92,6 +92,7 @@ typedef struct {
 	XAie_RegFldAttr	Done;
 	XAie_RegFldAttr Rst;		/**< Reset value field attributes */
 	XAie_RegFldAttr En;		/**< Enable value field attributes */
+	XAie_RegFldAttr ErrHalt;	/**< Error halt field attributes */
 } XAie_RegCoreSts;
 
 /*
@@ -241,6 +242,9 @@ typedef struct XAie_CoreMod {
 	const XAie_RegCoreProcBusCtrl *ProcBusCtrl;
 	AieRC (*ConfigureDone)(XAie_DevInst *DevInst, XAie_LocType Loc,
 			const struct XAie_CoreMod *CoreMod);
+	void (*GetDoneCond)(XAie_DevInst *DevInst, XAie_LocType Loc,
+			const struct XAie_CoreMod *CoreMod, u64 *RegAddr,
+			u32 *Mask, u32 *Value, u32 *ErrMask);
 	AieRC (*WaitForDone)(XAie_DevInst *DevInst, XAie_LocType Loc,
 			u32 TimeOut, const struct XAie_CoreMod *CoreMod);
 	AieRC (*ReadDoneBit)(XAie_DevInst *DevInst, XAie_LocType Loc,
@@ -455,6 +459,7 @@ typedef struct {
 	XAie_RegFldAttr StalledStreamStarve;
 	XAie_RegFldAttr TaskQSize;
 	XAie_RegFldAttr StalledTCT;
+	u32 ErrMask[DMA_MAX];	/* Error bits of S2MM and MM2S channels */
 } XAie_AieMlDmaChStatus;
 
 typedef union {
@@ -523,11 +528,16 @@ struct XAie_DmaMod {
 			u8 IterCurr);
 	AieRC (*WriteBd)(XAie_DevInst *DevInst, XAie_DmaDesc *Desc,
 			XAie_LocType Loc, u8 BdNum);
+	AieRC (*CompileBd)(XAie_DmaDesc *Desc, u32 *BdWord, u8 *NumBdWords);
 	AieRC (*ReadBd)(XAie_DevInst *DevInst, XAie_DmaDesc *Desc,
 			XAie_LocType Loc, u8 BdNum);
 	AieRC (*PendingBd)(XAie_DevInst *DevInst, XAie_LocType Loc,
 			const XAie_DmaMod *DmaMod, u8 ChNum,
 			XAie_DmaDirection Dir, u8 *PendingBd);
+	void (*GetDoneCond)(XAie_DevInst *DevInst, XAie_LocType Loc,
+			const XAie_DmaMod *DmaMod, u8 ChNum,
+			XAie_DmaDirection Dir, u64 *RegAddr, u32 *Mask,
+			u32 *Value, u32 *ErrMask);
 	AieRC (*WaitforDone)(XAie_DevInst *DevINst, XAie_LocType Loc,
 			const XAie_DmaMod *DmaMod, u8 ChNum,
 			XAie_DmaDirection Dir, u32 TimeOutUs);
@@ -120,7 +120,9 @@ static const XAie_RegCoreSts AieCoreStsReg =
 	.Done = {XAIEGBL_CORE_CORESTA_COREDON_LSB,
 		XAIEGBL_CORE_CORESTA_COREDON_MASK},
 	.Rst = {XAIEGBL_CORE_CORESTA_RST_LSB,XAIEGBL_CORE_CORESTA_RST_MASK},
-	.En = {XAIEGBL_CORE_CORESTA_ENA_LSB, XAIEGBL_CORE_CORESTA_ENA_MASK}
+	.En = {XAIEGBL_CORE_CORESTA_ENA_LSB, XAIEGBL_CORE_CORESTA_ENA_MASK},
+	.ErrHalt = {XAIEGBL_CORE_CORESTA_ERRHLT_LSB,
+		XAIEGBL_CORE_CORESTA_ERRHLT_MASK}
 };
 
 /*
@@ -1154,6 +1156,7 @@ static const XAie_CoreMod AieCoreMod =
 	.ProcBusCtrl = NULL,
 	.ConfigureDone = &_XAie_CoreConfigureDone,
 	.Enable = &_XAie_CoreEnable,
+	.GetDoneCond = &_XAie_CoreGetDoneCond,
 	.WaitForDone = &_XAie_CoreWaitForDone,
 	.ReadDoneBit = &_XAie_CoreReadDoneBit,
 	.GetCoreStatus = &_XAie_CoreGetStatus
@@ -1501,8 +1504,10 @@ static const XAie_DmaMod AieTileDmaMod =
 	.SetMultiDim = &_XAie_DmaSetMultiDim,
 	.SetBdIter = &_XAie_DmaSetBdIteration,
 	.WriteBd = &_XAie_TileDmaWriteBd,
+	.CompileBd = &_XAie_TileDmaCompileBd,
 	.ReadBd = &_XAie_TileDmaReadBd,
 	.PendingBd = &_XAie_DmaGetPendingBdCount,
+	.GetDoneCond = &_XAie_DmaGetDoneCond,
 	.WaitforDone = &_XAie_DmaWaitForDone,
 	.BdChValidity = &_XAie_DmaCheckBdChValidity,
 	.UpdateBdLen = &_XAie_DmaUpdateBdLen,
@@ -1704,8 +1709,10 @@ static const XAie_DmaMod AieShimDmaMod =
 	.SetMultiDim = NULL,
 	.SetBdIter = &_XAie_DmaSetBdIteration,
 	.WriteBd = &_XAie_ShimDmaWriteBd,
+	.CompileBd = &_XAie_ShimDmaCompileBd,
 	.ReadBd = &_XAie_ShimDmaReadBd,
 	.PendingBd = &_XAie_DmaGetPendingBdCount,
+	.GetDoneCond = &_XAie_DmaGetDoneCond,
 	.WaitforDone = &_XAie_DmaWaitForDone,
 	.BdChValidity = &_XAie_DmaCheckBdChValidity,
 	.UpdateBdLen = &_XAie_ShimDmaUpdateBdLen,
@@ -126,7 +126,9 @@ static const  XAie_RegCoreSts AieMlCoreStsReg =
 	.Rst = {XAIEMLGBL_CORE_MODULE_CORE_STATUS_RESET_LSB,
 		XAIEMLGBL_CORE_MODULE_CORE_STATUS_RESET_MASK},
 	.En = {XAIEMLGBL_CORE_MODULE_CORE_STATUS_ENABLE_LSB,
-		XAIEMLGBL_CORE_MODULE_CORE_STATUS_ENABLE_MASK}
+		XAIEMLGBL_CORE_MODULE_CORE_STATUS_ENABLE_MASK},
+	.ErrHalt = {XAIEMLGBL_CORE_MODULE_CORE_STATUS_ERROR_HALT_LSB,
+		XAIEMLGBL_CORE_MODULE_CORE_STATUS_ERROR_HALT_MASK}
 };
 
 /*
@@ -369,6 +371,20 @@ static const XAie_DmaChStatus AieMlMemTileDmaChStatus =
 	.AieMlDmaChStatus.StalledStreamStarve.Mask = XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_STALLED_STREAM_STARVATION_MASK,
 	.AieMlDmaChStatus.StalledTCT.Lsb = XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_STALLED_TCT_OR_COUNT_FIFO_FULL_LSB,
 	.AieMlDmaChStatus.StalledTCT.Mask = XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_STALLED_TCT_OR_COUNT_FIFO_FULL_MASK,
+	.AieMlDmaChStatus.ErrMask[DMA_S2MM] =
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_TASK_QUEUE_OVERFLOW_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_ERROR_FOT_BDS_PER_TASK_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_ERROR_FOT_LENGTH_EXCEEDED_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_ERROR_BD_INVALID_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_ERROR_BD_UNAVAILABLE_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_ERROR_DM_ACCESS_TO_UNAVAILABLE_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0_ERROR_LOCK_ACCESS_TO_UNAVAILABLE_MASK,
+	.AieMlDmaChStatus.ErrMask[DMA_MM2S] =
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_MM2S_STATUS_0_TASK_QUEUE_OVERFLOW_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_MM2S_STATUS_0_ERROR_BD_INVALID_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_MM2S_STATUS_0_ERROR_BD_UNAVAILABLE_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_MM2S_STATUS_0_ERROR_DM_ACCESS_TO_UNAVAILABLE_MASK |
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_MM2S_STATUS_0_ERROR_LOCK_ACCESS_TO_UNAVAILABLE_MASK,
 };
 
 static const  XAie_DmaChProp AieMlMemTileDmaChProp =
@@ -441,8 +457,10 @@ static const  XAie_DmaMod AieMlMemTileDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_MemTileDmaWriteBd,
+	.CompileBd = &_XAieMl_MemTileDmaCompileBd,
 	.ReadBd = &_XAieMl_MemTileDmaReadBd,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
+	.GetDoneCond = &_XAieMl_DmaGetDoneCond,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
 	.BdChValidity = &_XAieMl_MemTileDmaCheckBdChValidity,
 	.UpdateBdLen = &_XAieMl_DmaUpdateBdLen,
@@ -598,6 +616,15 @@ static const XAie_DmaChStatus AieMlTileDmaChStatus =
 	.AieMlDmaChStatus.StalledStreamStarve.Mask = XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_STALLED_STREAM_STARVATION_MASK,
 	.AieMlDmaChStatus.StalledTCT.Lsb = XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_STALLED_TCT_OR_COUNT_FIFO_FULL_LSB,
 	.AieMlDmaChStatus.StalledTCT.Mask = XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_STALLED_TCT_OR_COUNT_FIFO_FULL_MASK,
+	.AieMlDmaChStatus.ErrMask[DMA_S2MM] =
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_TASK_QUEUE_OVERFLOW_MASK |
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_ERROR_FOT_BDS_PER_TASK_MASK |
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_ERROR_FOT_LENGTH_EXCEEDED_MASK |
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_ERROR_BD_INVALID_MASK |
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_ERROR_BD_UNAVAILABLE_MASK,
+	.AieMlDmaChStatus.ErrMask[DMA_MM2S] =
+		XAIEMLGBL_MEMORY_MODULE_DMA_MM2S_STATUS_0_TASK_QUEUE_OVERFLOW_MASK |
+		XAIEMLGBL_MEMORY_MODULE_DMA_MM2S_STATUS_0_ERROR_BD_INVALID_MASK,
 };
 
 /* Data structure to capture register offsets and masks for Mem Tile and
@@ -673,8 +700,10 @@ static const  XAie_DmaMod AieMlTileDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_TileDmaWriteBd,
+	.CompileBd = &_XAieMl_TileDmaCompileBd,
 	.ReadBd = &_XAieMl_TileDmaReadBd,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
+	.GetDoneCond = &_XAieMl_DmaGetDoneCond,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
 	.BdChValidity = &_XAieMl_DmaCheckBdChValidity,
 	.UpdateBdLen = &_XAieMl_DmaUpdateBdLen,
@@ -845,6 +874,19 @@ static const XAie_DmaChStatus AieMlShimDmaChStatus =
 	.AieMlDmaChStatus.StalledStreamStarve.Mask = XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_STALLED_STREAM_STARVATION_MASK,
 	.AieMlDmaChStatus.StalledTCT.Lsb = XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_STALLED_TCT_OR_COUNT_FIFO_FULL_LSB,
 	.AieMlDmaChStatus.StalledTCT.Mask = XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_STALLED_TCT_OR_COUNT_FIFO_FULL_MASK,
+	.AieMlDmaChStatus.ErrMask[DMA_S2MM] =
+		XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_TASK_QUEUE_OVERFLOW_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_AXI_MM_SLAVE_ERROR_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_AXI_MM_DECODE_ERROR_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_ERROR_FOT_BDS_PER_TASK_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_ERROR_FOT_LENGTH_EXCEEDED_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_ERROR_BD_INVALID_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0_ERROR_BD_UNAVAILABLE_MASK,
+	.AieMlDmaChStatus.ErrMask[DMA_MM2S] =
+		XAIEMLGBL_NOC_MODULE_DMA_MM2S_STATUS_0_TASK_QUEUE_OVERFLOW_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_MM2S_STATUS_0_AXI_MM_SLAVE_ERROR_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_MM2S_STATUS_0_AXI_MM_DECODE_ERROR_MASK |
+		XAIEMLGBL_NOC_MODULE_DMA_MM2S_STATUS_0_ERROR_BD_INVALID_MASK,
 };
 
 /* Data structure to capture register offsets and masks for Mem Tile and
@@ -920,8 +962,10 @@ static const  XAie_DmaMod AieMlShimDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_ShimDmaWriteBd,
+	.CompileBd = &_XAieMl_ShimDmaCompileBd,
 	.ReadBd = &_XAieMl_ShimDmaReadBd,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
+	.GetDoneCond = &_XAieMl_DmaGetDoneCond,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
 	.BdChValidity = &_XAieMl_DmaCheckBdChValidity,
 	.UpdateBdLen = &_XAieMl_ShimDmaUpdateBdLen,
@@ -2298,6 +2342,7 @@ static const  XAie_CoreMod AieMlCoreMod =
 	.ProcBusCtrl = &AieMlCoreProcBusCtrlReg,
 	.ConfigureDone = &_XAieMl_CoreConfigureDone,
 	.Enable = &_XAieMl_CoreEnable,
+	.GetDoneCond = &_XAieMl_CoreGetDoneCond,
 	.WaitForDone = &_XAieMl_CoreWaitForDone,
 	.ReadDoneBit = &_XAieMl_CoreReadDoneBit,
 	.GetCoreStatus = &_XAieMl_CoreGetStatus
@@ -46,6 +46,8 @@
 typedef struct {
 	u64 BaseAddr;
 	u64 NpiBaseAddr;
+	XAie_PollCtx *Poll;	/* Poll settings of the device instance */
+	XAie_DevInst *DevInst;
 } XAie_BaremetalIO;
 
 /************************** Variable Definitions *****************************/
@@ -89,6 +91,8 @@ static AieRC XAie_BaremetalIO_Init(XAie_DevInst *DevInst)
 
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst->Poll = &DevInst->Poll;
+	IOInst->DevInst = DevInst;
 	DevInst->IOInst = IOInst;
 
 	return XAIE_OK;
@@ -192,32 +196,10 @@ static AieRC XAie_BaremetalIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_BaremetalIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value, u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
-
-	while (Count > 0U) {
-		XAie_BaremetalIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			return XAIE_OK;
-		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
-
-	/* Check for the break from timed-out loop */
-	XAie_BaremetalIO_Read32(IOInst, RegOff, &RegVal);
-	if((RegVal & Mask) == Value) {
-		Ret = XAIE_OK;
-	}
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
 
-	return Ret;
+	return _XAie_IOCommon_MaskPoll(IOInst, XAie_BaremetalIO_Read32,
+			BaremetalIOInst->Poll, RegOff, Mask, Value, TimeOutUs);
 }
 
 /*****************************************************************************/
@@ -238,6 +220,16 @@ static AieRC XAie_BaremetalIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_BaremetalIO_BlockWrite32(void *IOInst, u64 RegOff,
 		const u32 *Data, u32 Size)
 {
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsMemRange(BaremetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_MemCopyTo((void *)(uintptr_t)
+				(BaremetalIOInst->BaseAddr + RegOff), Data,
+				Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0U; i < Size; i++) {
 		XAie_BaremetalIO_Write32(IOInst, RegOff + i * 4U, *Data);
 		Data++;
@@ -265,12 +257,57 @@ static AieRC XAie_BaremetalIO_BlockWrite32(void *IOInst, u64 RegOff,
 static AieRC XAie_BaremetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 		u32 Size)
 {
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsMemRange(BaremetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_MemSet((void *)(uintptr_t)
+				(BaremetalIOInst->BaseAddr + RegOff), Data,
+				Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0U; i < Size; i++)
 		XAie_BaremetalIO_Write32(IOInst, RegOff+ i * 4U, Data);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to the buffer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_BaremetalIO_BlockRead32(void *IOInst, u64 RegOff,
+		u32 *Data, u32 Size)
+{
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsMemRange(BaremetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_MemCopyFrom(Data, (const void *)(uintptr_t)
+				(BaremetalIOInst->BaseAddr + RegOff), Size);
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0U; i < Size; i++) {
+		Data[i] = Xil_In32(BaremetalIOInst->BaseAddr + RegOff +
+				i * 4U);
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -549,6 +586,9 @@ static AieRC XAie_BaremetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			BaremetalIOInst->NpiBaseAddr = *((u64 *)Arg);
 			break;
 		}
+		case XAIE_BACKEND_OP_FLUSH_WRITES:
+			/* Writes are issued immediately */
+			return XAIE_OK;
 		default:
 			XAIE_ERROR("Baremetal backend doesn't support operation"
 					" %d\n", Op);
@@ -643,6 +683,18 @@ static AieRC XAie_BaremetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_ERR;
 }
 
+static AieRC XAie_BaremetalIO_BlockRead32(void *IOInst, u64 RegOff,
+		u32 *Data, u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static XAie_MemInst* XAie_BaremetalMemAllocate(XAie_DevInst *DevInst, u64 Size,
 		XAie_MemCacheProp Cache)
 {
@@ -721,6 +773,7 @@ const XAie_Backend BaremetalBackend =
 	.Ops.MaskPoll = XAie_BaremetalIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_BaremetalIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_BaremetalIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_BaremetalIO_BlockRead32,
 	.Ops.CmdWrite = XAie_BaremetalIO_CmdWrite,
 	.Ops.RunOp = XAie_BaremetalIO_RunOp,
 	.Ops.MemAllocate = XAie_BaremetalMemAllocate,
@@ -38,17 +38,474 @@
 #include "xaie_io_common.h"
 #include "xaie_io_privilege.h"
 #include "xaie_npi.h"
+#include "xaie_shadow.h"
+#include "xaie_sync.h"
 
 /************************** Constant Definitions *****************************/
+#define XAIE_CDO_BUF_MAX_CMDS		1024U
+#define XAIE_CDO_BUF_MAX_WORDS		16384U
+#define XAIE_CDO_BUF_HASH_SIZE		(2U * XAIE_CDO_BUF_MAX_CMDS)
+#define XAIE_CDO_BUF_HASH_MULTIPLIER	0x9E3779B97F4A7C15ULL
+
+/*
+ * Payload words of the CDO commands with 64-bit addresses. The command header
+ * takes one word, and a second one if the payload is longer than 254 words.
+ */
+#define XAIE_CDO_WRITE_WORDS		3U
+#define XAIE_CDO_MASKWRITE_WORDS	4U
+#define XAIE_CDO_MASKPOLL_WORDS		5U
+#define XAIE_CDO_BLOCKSET_WORDS		4U
+#define XAIE_CDO_BLOCKWRITE_WORDS	2U
+#define XAIE_CDO_SHORT_PAYLOAD_MAX	254U
+
 /****************************** Type Definitions *****************************/
+/* Register write held in the write buffer of the CDO backend */
+typedef struct {
+	XAie_TxnOpcode Opcode;
+	u64 RegOff;
+	u32 Mask;
+	u32 Value;
+	u32 DataIdx;	/* First word of the block write in the data buffer */
+	u32 Size;	/* Number of 32-bit words, 0 if the write was dropped */
+} XAie_CdoCmd;
+
 typedef struct {
 	u64 BaseAddr;
 	u64 NpiBaseAddr;
+	XAie_DevInst *DevInst;
+	XAie_CdoCmd *BufCmds;	/* Register writes not yet emitted */
+	u32 BufNumCmds;
+	u32 *BufData;		/* Data of the buffered block writes */
+	u32 BufNumWords;
+	u32 *BufHash;		/* Index + 1 of the buffered single writes */
+	XAie_CdoStats Stats;
 } XAie_CdoIO;
 
 /************************** Function Definitions *****************************/
 #ifdef __AIECDO__
 
+/*****************************************************************************/
+/**
+*
+* This function accounts a CDO command in the statistics of the IO instance.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	PayloadWords: Number of payload words of the command.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline void _XAie_CdoIO_CountCmd(XAie_CdoIO *IOInst, u32 PayloadWords)
+{
+	u32 HdrWords = (PayloadWords > XAIE_CDO_SHORT_PAYLOAD_MAX) ? 2U : 1U;
+
+	IOInst->Stats.NumOps++;
+	IOInst->Stats.NumBytes += ((u64)HdrWords + PayloadWords) * sizeof(u32);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function emits a register write command to the CDO.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	Cmd: Register write command.
+* @param	Data: Data of block write commands, unused otherwise.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_EmitCmd(XAie_CdoIO *IOInst, const XAie_CdoCmd *Cmd,
+		const u32 *Data)
+{
+	u64 Addr = IOInst->BaseAddr + Cmd->RegOff;
+
+	switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			cdo_Write32(Addr, Cmd->Value);
+			_XAie_CdoIO_CountCmd(IOInst, XAIE_CDO_WRITE_WORDS);
+			break;
+		case XAIE_IO_MASKWRITE:
+			cdo_MaskWrite32(Addr, Cmd->Mask, Cmd->Value);
+			_XAie_CdoIO_CountCmd(IOInst, XAIE_CDO_MASKWRITE_WORDS);
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			cdo_BlockWrite32(Addr, Data, Cmd->Size);
+			_XAie_CdoIO_CountCmd(IOInst,
+					XAIE_CDO_BLOCKWRITE_WORDS + Cmd->Size);
+			break;
+		default:
+			cdo_BlockSet32(Addr, Cmd->Value, Cmd->Size);
+			_XAie_CdoIO_CountCmd(IOInst, XAIE_CDO_BLOCKSET_WORDS);
+			break;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function emits the buffered register writes to the CDO in order and
+* empties the write buffer.
+*
+* @param	IOInst: CDO IO instance pointer
+*
+* @return	None.
+*
+* @note		Internal only. It is called before any command which has to
+*		observe the effect of the previous writes, such as polls and
+*		backend operations.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_FlushWrites(XAie_CdoIO *IOInst)
+{
+	if(IOInst->BufNumCmds == 0U) {
+		return;
+	}
+
+	for(u32 i = 0U; i < IOInst->BufNumCmds; i++) {
+		const XAie_CdoCmd *Cmd = &IOInst->BufCmds[i];
+
+		if(Cmd->Size == 0U) {
+			continue;
+		}
+
+		_XAie_CdoIO_EmitCmd(IOInst, Cmd, &IOInst->BufData[Cmd->DataIdx]);
+	}
+
+	IOInst->BufNumCmds = 0U;
+	IOInst->BufNumWords = 0U;
+	memset(IOInst->BufHash, 0, XAIE_CDO_BUF_HASH_SIZE *
+			sizeof(*IOInst->BufHash));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the hash table slot of a buffered single register
+* write. The slot holds the index + 1 of the command in the write buffer.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	RegOff: Register offset of the write.
+*
+* @return	Slot of the register or the first empty slot of its probe
+*		sequence. NULL if the table is full.
+*
+* @note		Internal only. Slots of dropped and merged writes are kept
+*		until the buffer is flushed, the command of a slot must be
+*		checked by the caller.
+*
+*******************************************************************************/
+static u32 *_XAie_CdoIO_HashSlot(XAie_CdoIO *IOInst, u64 RegOff)
+{
+	u32 Idx = (u32)(((RegOff >> 2U) * XAIE_CDO_BUF_HASH_MULTIPLIER) >> 32U) &
+		(XAIE_CDO_BUF_HASH_SIZE - 1U);
+
+	for(u32 i = 0U; i < XAIE_CDO_BUF_HASH_SIZE; i++) {
+		u32 *Slot = &IOInst->BufHash[Idx];
+
+		if((*Slot == 0U) ||
+				(IOInst->BufCmds[*Slot - 1U].RegOff == RegOff)) {
+			return Slot;
+		}
+
+		Idx = (Idx + 1U) & (XAIE_CDO_BUF_HASH_SIZE - 1U);
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function drops the buffered single writes of the registers which are
+* overwritten by a new write. Only the static configuration registers known to
+* the shadow cache are considered, as dropping a write to a register with side
+* effects, such as a DMA queue or a lock, would change the behaviour of the
+* hardware.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	RegOff: Register offset of the new write.
+* @param	Size: Number of 32-bit words of the new write.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_DropOverwritten(XAie_CdoIO *IOInst, u64 RegOff,
+		u32 Size)
+{
+	if(IOInst->DevInst->ShadowCache == NULL) {
+		return;
+	}
+
+	for(u32 i = 0U; i < Size; i++) {
+		u64 Off = RegOff + (u64)i * sizeof(u32);
+		u32 *Slot = _XAie_CdoIO_HashSlot(IOInst, Off);
+		XAie_CdoCmd *Cmd;
+
+		if((Slot == NULL) || (*Slot == 0U)) {
+			continue;
+		}
+
+		Cmd = &IOInst->BufCmds[*Slot - 1U];
+		if((Cmd->Opcode != XAIE_IO_WRITE) || (Cmd->Size == 0U) ||
+				!_XAie_ShadowIsStaticReg(IOInst->DevInst, Off)) {
+			continue;
+		}
+
+		Cmd->Size = 0U;
+		IOInst->Stats.NumDropped++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks if a write can be appended to the last buffered
+* command as a single block write.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	RegOff: Register offset of the write.
+* @param	Size: Number of 32-bit words of the write.
+*
+* @return	XAIE_ENABLE if the write can be merged, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_CdoIO_CanMerge(XAie_CdoIO *IOInst, u64 RegOff, u32 Size)
+{
+	const XAie_CdoCmd *Last;
+	u32 NumWords = Size;
+
+	if(IOInst->BufNumCmds == 0U) {
+		return XAIE_DISABLE;
+	}
+
+	Last = &IOInst->BufCmds[IOInst->BufNumCmds - 1U];
+	if(Last->Size == 0U) {
+		return XAIE_DISABLE;
+	}
+
+	if(Last->Opcode == XAIE_IO_WRITE) {
+		NumWords++;
+	} else if(Last->Opcode != XAIE_IO_BLOCKWRITE) {
+		return XAIE_DISABLE;
+	}
+
+	return (Last->RegOff + (u64)Last->Size * sizeof(u32) == RegOff) &&
+		(IOInst->BufNumWords + NumWords <= XAIE_CDO_BUF_MAX_WORDS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function appends the data of a write to the last buffered command. A
+* single write is turned into a block write first. The data of the last
+* command is always at the end of the data buffer.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	Data: Data of the write.
+* @param	Size: Number of 32-bit words of the write.
+*
+* @return	None.
+*
+* @note		Internal only. _XAie_CdoIO_CanMerge must be checked first.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_Merge(XAie_CdoIO *IOInst, const u32 *Data, u32 Size)
+{
+	XAie_CdoCmd *Last = &IOInst->BufCmds[IOInst->BufNumCmds - 1U];
+
+	if(Last->Opcode == XAIE_IO_WRITE) {
+		Last->Opcode = XAIE_IO_BLOCKWRITE;
+		Last->DataIdx = IOInst->BufNumWords;
+		IOInst->BufData[IOInst->BufNumWords++] = Last->Value;
+	}
+
+	memcpy(&IOInst->BufData[IOInst->BufNumWords], Data,
+			Size * sizeof(*Data));
+	IOInst->BufNumWords += Size;
+	Last->Size += Size;
+	IOInst->Stats.NumMerged++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a register write command to the write buffer of the IO
+* instance. Writes following the last buffered write or block write are merged
+* into a single block write. The buffer is flushed first if it cannot hold the
+* command. Block writes larger than the data buffer are emitted immediately
+* with the data of the caller.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	Cmd: Register write command.
+* @param	Data: Data of block write commands, unused otherwise.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_BufferCmd(XAie_CdoIO *IOInst, const XAie_CdoCmd *Cmd,
+		const u32 *Data)
+{
+	XAie_CdoCmd *NewCmd;
+	u32 NumWords = 0U;
+
+	if(Cmd->Opcode != XAIE_IO_MASKWRITE) {
+		_XAie_CdoIO_DropOverwritten(IOInst, Cmd->RegOff, Cmd->Size);
+	}
+
+	if((Cmd->Opcode == XAIE_IO_WRITE) &&
+			_XAie_CdoIO_CanMerge(IOInst, Cmd->RegOff, 1U)) {
+		_XAie_CdoIO_Merge(IOInst, &Cmd->Value, 1U);
+		return;
+	}
+
+	if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+		if(_XAie_CdoIO_CanMerge(IOInst, Cmd->RegOff, Cmd->Size)) {
+			_XAie_CdoIO_Merge(IOInst, Data, Cmd->Size);
+			return;
+		}
+
+		NumWords = Cmd->Size;
+		if(NumWords > XAIE_CDO_BUF_MAX_WORDS) {
+			_XAie_CdoIO_FlushWrites(IOInst);
+			_XAie_CdoIO_EmitCmd(IOInst, Cmd, Data);
+			return;
+		}
+	}
+
+	if((IOInst->BufNumCmds == XAIE_CDO_BUF_MAX_CMDS) ||
+			(IOInst->BufNumWords + NumWords >
+			 XAIE_CDO_BUF_MAX_WORDS)) {
+		_XAie_CdoIO_FlushWrites(IOInst);
+	}
+
+	NewCmd = &IOInst->BufCmds[IOInst->BufNumCmds];
+	*NewCmd = *Cmd;
+	if(NumWords > 0U) {
+		NewCmd->DataIdx = IOInst->BufNumWords;
+		memcpy(&IOInst->BufData[IOInst->BufNumWords], Data,
+				NumWords * sizeof(*Data));
+		IOInst->BufNumWords += NumWords;
+	}
+
+	if(Cmd->Opcode == XAIE_IO_WRITE) {
+		u32 *Slot = _XAie_CdoIO_HashSlot(IOInst, Cmd->RegOff);
+
+		if(Slot != NULL) {
+			*Slot = IOInst->BufNumCmds + 1U;
+		}
+	}
+
+	IOInst->BufNumCmds++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function passes a register write command to the write buffer if
+* buffering is enabled, or emits it to the CDO otherwise.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	Cmd: Register write command.
+* @param	Data: Data of block write commands, unused otherwise.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_SubmitCmd(XAie_CdoIO *IOInst, const XAie_CdoCmd *Cmd,
+		const u32 *Data)
+{
+	IOInst->Stats.NumWrites++;
+
+	if(IOInst->BufCmds == NULL) {
+		_XAie_CdoIO_EmitCmd(IOInst, Cmd, Data);
+		return;
+	}
+
+	_XAie_CdoIO_BufferCmd(IOInst, Cmd, Data);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function allocates the write buffer of the IO instance.
+*
+* @param	IOInst: CDO IO instance pointer
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Enabling an enabled buffer is a no-op.
+*
+*******************************************************************************/
+static AieRC _XAie_CdoIO_InitWriteBuf(XAie_CdoIO *IOInst)
+{
+	if(IOInst->BufCmds != NULL) {
+		return XAIE_OK;
+	}
+
+	IOInst->BufNumCmds = 0U;
+	IOInst->BufNumWords = 0U;
+	IOInst->BufCmds = malloc(XAIE_CDO_BUF_MAX_CMDS *
+			sizeof(*IOInst->BufCmds));
+	IOInst->BufData = malloc(XAIE_CDO_BUF_MAX_WORDS *
+			sizeof(*IOInst->BufData));
+	IOInst->BufHash = calloc(XAIE_CDO_BUF_HASH_SIZE,
+			sizeof(*IOInst->BufHash));
+	if((IOInst->BufCmds == NULL) || (IOInst->BufData == NULL) ||
+			(IOInst->BufHash == NULL)) {
+		XAIE_ERROR("Memory allocation for CDO write buffer failed\n");
+		free(IOInst->BufCmds);
+		free(IOInst->BufData);
+		free(IOInst->BufHash);
+		IOInst->BufCmds = NULL;
+		IOInst->BufData = NULL;
+		IOInst->BufHash = NULL;
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function emits the buffered writes and releases the write buffer of
+* the IO instance.
+*
+* @param	IOInst: CDO IO instance pointer
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_FreeWriteBuf(XAie_CdoIO *IOInst)
+{
+	if(IOInst->BufCmds == NULL) {
+		return;
+	}
+
+	_XAie_CdoIO_FlushWrites(IOInst);
+	free(IOInst->BufCmds);
+	free(IOInst->BufData);
+	free(IOInst->BufHash);
+	IOInst->BufCmds = NULL;
+	IOInst->BufData = NULL;
+	IOInst->BufHash = NULL;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -64,6 +521,7 @@ typedef struct {
 *******************************************************************************/
 static AieRC XAie_CdoIO_Finish(void *IOInst)
 {
+	_XAie_CdoIO_FreeWriteBuf((XAie_CdoIO *)IOInst);
 	free(IOInst);
 	return XAIE_OK;
 }
@@ -84,7 +542,7 @@ static AieRC XAie_CdoIO_Init(XAie_DevInst *DevInst)
 {
 	XAie_CdoIO *IOInst;
 
-	IOInst = (XAie_CdoIO *)malloc(sizeof(*IOInst));
+	IOInst = (XAie_CdoIO *)calloc(1U, sizeof(*IOInst));
 	if(IOInst == NULL) {
 		XAIE_ERROR("Memory allocation failed\n");
 		return XAIE_ERR;
@@ -92,6 +550,7 @@ static AieRC XAie_CdoIO_Init(XAie_DevInst *DevInst)
 
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst->DevInst = DevInst;
 	DevInst->IOInst = IOInst;
 
 	return XAIE_OK;
@@ -114,9 +573,9 @@ static AieRC XAie_CdoIO_Init(XAie_DevInst *DevInst)
 *******************************************************************************/
 static AieRC XAie_CdoIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 {
-	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
+	XAie_CdoCmd Cmd = {XAIE_IO_WRITE, RegOff, 0U, Value, 0U, 1U};
 
-	cdo_Write32(CdoIOInst->BaseAddr + RegOff, Value);
+	_XAie_CdoIO_SubmitCmd((XAie_CdoIO *)IOInst, &Cmd, NULL);
 
 	return XAIE_OK;
 }
@@ -165,8 +624,9 @@ static AieRC XAie_CdoIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 static AieRC XAie_CdoIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
-	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
-	cdo_MaskWrite32(CdoIOInst->BaseAddr + RegOff, Mask, Value);
+	XAie_CdoCmd Cmd = {XAIE_IO_MASKWRITE, RegOff, Mask, Value, 0U, 1U};
+
+	_XAie_CdoIO_SubmitCmd((XAie_CdoIO *)IOInst, &Cmd, NULL);
 
 	return XAIE_OK;
 }
@@ -192,9 +652,12 @@ static AieRC XAie_CdoIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs)
 {
 	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
+
+	_XAie_CdoIO_FlushWrites(CdoIOInst);
 	/* Round up to msec */
 	cdo_MaskPoll(CdoIOInst->BaseAddr + RegOff, Mask, Value,
 			(TimeOutUs + 999) / 1000);
+	_XAie_CdoIO_CountCmd(CdoIOInst, XAIE_CDO_MASKPOLL_WORDS);
 	return XAIE_OK;
 }
 
@@ -217,9 +680,9 @@ static AieRC XAie_CdoIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 static AieRC XAie_CdoIO_BlockWrite32(void *IOInst, u64 RegOff, const u32 *Data,
 		u32 Size)
 {
-	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
+	XAie_CdoCmd Cmd = {XAIE_IO_BLOCKWRITE, RegOff, 0U, 0U, 0U, Size};
 
-	cdo_BlockWrite32(CdoIOInst->BaseAddr + RegOff, Data, Size);
+	_XAie_CdoIO_SubmitCmd((XAie_CdoIO *)IOInst, &Cmd, Data);
 
 	return XAIE_OK;
 }
@@ -243,9 +706,9 @@ static AieRC XAie_CdoIO_BlockWrite32(void *IOInst, u64 RegOff, const u32 *Data,
 *******************************************************************************/
 static AieRC XAie_CdoIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data, u32 Size)
 {
-	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
+	XAie_CdoCmd Cmd = {XAIE_IO_BLOCKSET, RegOff, 0U, Data, 0U, Size};
 
-	cdo_BlockSet32(CdoIOInst->BaseAddr + RegOff, Data, Size);
+	_XAie_CdoIO_SubmitCmd((XAie_CdoIO *)IOInst, &Cmd, NULL);
 
 	return XAIE_OK;
 }
@@ -272,6 +735,7 @@ static void _XAie_CdoIO_NpiWrite32(void *IOInst, u32 RegOff, u32 RegVal)
 
 	RegAddr = CdoIOInst->NpiBaseAddr + RegOff;
 	cdo_Write32(RegAddr, RegVal);
+	_XAie_CdoIO_CountCmd(CdoIOInst, XAIE_CDO_WRITE_WORDS);
 	return;
 }
 
@@ -299,6 +763,7 @@ static AieRC _XAie_CdoIO_NpiMaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 	/* Round up to msec */
 	cdo_MaskPoll(CdoIOInst->NpiBaseAddr + RegOff, Mask, Value,
 			(TimeOutUs + 999) / 1000);
+	_XAie_CdoIO_CountCmd(CdoIOInst, XAIE_CDO_MASKPOLL_WORDS);
 	return XAIE_OK;
 }
 
@@ -321,7 +786,9 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		     XAie_BackendOpCode Op, void *Arg)
 {
 	AieRC RC = XAIE_OK;
-	(void)IOInst;
+
+	/* Keep the buffered writes ahead of the commands of the operation */
+	_XAie_CdoIO_FlushWrites((XAie_CdoIO *)IOInst);
 
 	switch(Op) {
 		case XAIE_BACKEND_OP_NPIWR32:
@@ -384,6 +851,8 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			CdoIOInst->NpiBaseAddr = *((u64 *)Arg);
 			break;
 		}
+		case XAIE_BACKEND_OP_FLUSH_WRITES:
+			break;
 		default:
 			XAIE_ERROR("CDO backend doesn't support operation"
 					" %u.\n", Op);
@@ -394,6 +863,100 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 	return RC;
 }
 
+/*****************************************************************************/
+/**
+*
+* This api enables or disables the write buffer of the CDO backend. With the
+* buffer enabled, register writes are held back until the next poll, backend
+* operation or XAie_FlushWrites and emitted with fewer CDO commands:
+*	- Writes and block writes to consecutive addresses are merged into a
+*	  single block write.
+*	- When the shadow cache is enabled, a write to a static configuration
+*	  register is dropped if the register is written again before the
+*	  buffered writes are emitted. Registers with side effects on write are
+*	  never dropped.
+* The order of the emitted commands follows the order of the writes.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Enable - XAIE_ENABLE to buffer the writes, XAIE_DISABLE to emit
+*		the buffered writes and write through.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		XAie_FlushWrites must be called before the CDO is closed if
+*		the CDO is closed before XAie_Finish.
+*
+******************************************************************************/
+AieRC XAie_CdoSetBuffering(XAie_DevInst *DevInst, u8 Enable)
+{
+	XAie_CdoIO *IOInst;
+	AieRC RC = XAIE_OK;
+	u32 Token;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->Backend->Type != XAIE_IO_BACKEND_CDO) {
+		XAIE_ERROR("CDO backend is not in use\n");
+		return XAIE_INVALID_BACKEND;
+	}
+
+	IOInst = (XAie_CdoIO *)_XAie_GetBackendIOInst(DevInst);
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	if(Enable == XAIE_ENABLE) {
+		RC = _XAie_CdoIO_InitWriteBuf(IOInst);
+	} else {
+		_XAie_CdoIO_FreeWriteBuf(IOInst);
+	}
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api returns the number and the size of the CDO commands emitted by the
+* CDO backend, together with the effect of the write buffer.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Stats - Pointer to store the statistics.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Buffered writes are counted once they are emitted. Call
+*		XAie_FlushWrites first to get the final size of the CDO. The
+*		size is computed from the encoding of the commands with 64-bit
+*		addresses.
+*
+******************************************************************************/
+AieRC XAie_CdoGetStats(XAie_DevInst *DevInst, XAie_CdoStats *Stats)
+{
+	XAie_CdoIO *IOInst;
+	u32 Token;
+
+	if((DevInst == XAIE_NULL) || (Stats == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->Backend->Type != XAIE_IO_BACKEND_CDO) {
+		XAIE_ERROR("CDO backend is not in use\n");
+		return XAIE_INVALID_BACKEND;
+	}
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	IOInst = (XAie_CdoIO *)_XAie_GetBackendIOInst(DevInst);
+	*Stats = IOInst->Stats;
+	_XAie_SyncRelease(DevInst, Token);
+
+	return XAIE_OK;
+}
+
 #else
 
 static AieRC XAie_CdoIO_Finish(void *IOInst)
@@ -489,6 +1052,20 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
 
+AieRC XAie_CdoSetBuffering(XAie_DevInst *DevInst, u8 Enable)
+{
+	(void)DevInst;
+	(void)Enable;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_CdoGetStats(XAie_DevInst *DevInst, XAie_CdoStats *Stats)
+{
+	(void)DevInst;
+	(void)Stats;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
 #endif /* __AIECDO__ */
 
 static AieRC XAie_CdoIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
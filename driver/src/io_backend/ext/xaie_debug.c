@@ -391,6 +391,9 @@ static AieRC XAie_DebugIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			DebugIOInst->NpiBaseAddr = *((u64 *)Arg);
 			break;
 		}
+		case XAIE_BACKEND_OP_FLUSH_WRITES:
+			/* Writes are issued immediately */
+			return XAIE_OK;
 		default:
 			XAIE_ERROR("Debug backend doesn't support operation"
 					" %u.\n", Op);
@@ -24,14 +24,21 @@
 /***************************** Include Files *********************************/
 #include <stdlib.h>
 #include <string.h>
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 
 #include "xaie_feature_config.h"
 #include "xaie_io.h"
+#include "xaie_io_common.h"
 #include "xaie_helper.h"
 #include "xaie_rsc_internal.h"
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
 #define XAIE_BROADCAST_CHANNEL_MASK     0xFFFFU
+#define XAIE_IO_WIDE_WORDS		4U	/* Words of a 128-bit access */
+#define XAIE_IO_WIDE_ALIGN_MASK		0xFU
+#define XAIE_IO_NONTEMPORAL_MIN_WORDS	1024U
 
 /************************** Function Definitions *****************************/
 #ifdef XAIE_FEATURE_RSC_ENABLE
@@ -663,4 +670,355 @@ void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 	}
 }
 
+/* Register condition polled by _XAie_IOCommon_MaskPoll() */
+typedef struct {
+	void *IOInst;
+	XAie_IOCommonRead32 Read32;
+	u64 RegOff;
+	u32 Mask;
+	u32 Value;
+} XAie_IOCommonPollArgs;
+
+static AieRC _XAie_IOCommon_MaskPollCheck(void *Priv, u8 *Done)
+{
+	XAie_IOCommonPollArgs *Args = (XAie_IOCommonPollArgs *)Priv;
+	u32 RegVal;
+	AieRC RC;
+
+	RC = Args->Read32(Args->IOInst, Args->RegOff, &RegVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	*Done = ((RegVal & Args->Mask) == Args->Value) ? 1U : 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API polls a register until the masked value matches or the timeout
+* expires, with the poll loop of _XAie_PollCondition().
+*
+* @param	IOInst: IO instance pointer of the backend.
+* @param	Read32: Register read function of the backend.
+* @param	Poll: Poll configuration and statistics of the device instance.
+*		If NULL, the default configuration is used and no statistics
+*		are recorded.
+* @param	RegOff: Register offset to read from.
+* @param	Mask: Mask to be applied to the register value.
+* @param	Value: 32-bit value to poll for.
+* @param	TimeOutUs: Timeout in micro seconds. The register is read at
+*		least once.
+*
+* @return	XAIE_OK if the value matches, XAIE_ERR on timeout or if the
+*		read fails.
+*
+* @note		Internal only. Backends which keep the device instance in the
+*		IO instance shall pass its poll context.
+*
+*******************************************************************************/
+AieRC _XAie_IOCommon_MaskPoll(void *IOInst, XAie_IOCommonRead32 Read32,
+		XAie_PollCtx *Poll, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs)
+{
+	XAie_IOCommonPollArgs Args;
+
+	Args.IOInst = IOInst;
+	Args.Read32 = Read32;
+	Args.RegOff = RegOff;
+	Args.Mask = Mask;
+	Args.Value = Value;
+
+	if(_XAie_PollCondition(Poll, _XAie_IOCommon_MaskPollCheck, &Args,
+				TimeOutUs) != XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a range of registers lies within the program memory or
+* data memory of a single tile. Such ranges accept 128-bit accesses, other
+* registers shall be accessed 32 bits at a time.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Partition relative offset of the first word.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_ENABLE if the range is memory, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+u8 _XAie_IOCommon_IsMemRange(XAie_DevInst *DevInst, u64 RegOff, u32 Size)
+{
+	const XAie_TileMod *TileMod;
+	XAie_LocType Loc;
+	u64 Addr, End;
+	u8 TileType;
+
+	Loc.Col = _XAie_GetColfromRegOff(DevInst, RegOff);
+	Loc.Row = _XAie_GetRowfromRegOff(DevInst, RegOff);
+	Addr = RegOff & ((1ULL << DevInst->DevProp.RowShift) - 1U);
+	End = Addr + (u64)Size * sizeof(u32);
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if(TileType >= XAIEGBL_TILE_TYPE_MAX) {
+		return XAIE_DISABLE;
+	}
+
+	TileMod = &DevInst->DevProp.DevMod[TileType];
+	if((TileMod->MemMod != NULL) && (Addr >= TileMod->MemMod->MemAddr) &&
+			(End <= (u64)TileMod->MemMod->MemAddr +
+			 TileMod->MemMod->Size)) {
+		return XAIE_ENABLE;
+	}
+
+	if((TileMod->CoreMod != NULL) &&
+			(Addr >= TileMod->CoreMod->ProgMemHostOffset) &&
+			(End <= (u64)TileMod->CoreMod->ProgMemHostOffset +
+			 TileMod->CoreMod->ProgMemSize)) {
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stores four words to 16 byte aligned mapped AIE memory with a single
+* 128-bit access.
+*
+* @param	Dest: Destination address, 16 byte aligned.
+* @param	Src: Source words, no alignment required.
+* @param	NonTemporal: XAIE_ENABLE to bypass the CPU caches.
+*
+* @return	None.
+*
+* @note		Internal only. Architectures without 128-bit stores issue four
+*		32-bit stores.
+*
+*******************************************************************************/
+static inline void _XAie_IOWideStore(volatile u32 *Dest, const u32 *Src,
+		u8 NonTemporal)
+{
+#if defined(__x86_64__)
+	__m128i Val = _mm_loadu_si128((const __m128i *)(const void *)Src);
+
+	if(NonTemporal == XAIE_ENABLE) {
+		_mm_stream_si128((__m128i *)(uintptr_t)Dest, Val);
+	} else {
+		_mm_store_si128((__m128i *)(uintptr_t)Dest, Val);
+	}
+#elif defined(__aarch64__)
+	u64 Lo, Hi;
+
+	memcpy(&Lo, Src, sizeof(Lo));
+	memcpy(&Hi, Src + 2U, sizeof(Hi));
+	if(NonTemporal == XAIE_ENABLE) {
+		__asm__ __volatile__("stnp %x0, %x1, [%2]" : :
+				"r" (Lo), "r" (Hi), "r" (Dest) : "memory");
+	} else {
+		__asm__ __volatile__("stp %x0, %x1, [%2]" : :
+				"r" (Lo), "r" (Hi), "r" (Dest) : "memory");
+	}
+#else
+	(void)NonTemporal;
+	Dest[0U] = Src[0U];
+	Dest[1U] = Src[1U];
+	Dest[2U] = Src[2U];
+	Dest[3U] = Src[3U];
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads four words from 16 byte aligned mapped AIE memory with a
+* single 128-bit access.
+*
+* @param	Dest: Destination words, no alignment required.
+* @param	Src: Source address, 16 byte aligned.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline void _XAie_IOWideLoad(u32 *Dest, const volatile u32 *Src)
+{
+#if defined(__x86_64__)
+	__m128i Val = _mm_load_si128((const __m128i *)(uintptr_t)Src);
+
+	_mm_storeu_si128((__m128i *)(void *)Dest, Val);
+#elif defined(__aarch64__)
+	u64 Lo, Hi;
+
+	__asm__ __volatile__("ldp %x0, %x1, [%2]" : "=r" (Lo), "=r" (Hi) :
+			"r" (Src) : "memory");
+	memcpy(Dest, &Lo, sizeof(Lo));
+	memcpy(Dest + 2U, &Hi, sizeof(Hi));
+#else
+	Dest[0U] = Src[0U];
+	Dest[1U] = Src[1U];
+	Dest[2U] = Src[2U];
+	Dest[3U] = Src[3U];
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API orders the non-temporal stores of a wide copy before any later
+* store, so that the copied words are visible to the device before the
+* registers that start it are written.
+*
+* @param	NonTemporal: XAIE_ENABLE if the copy used non-temporal stores.
+*
+* @return	None.
+*
+* @note		Internal only. Nothing is done for copies with regular stores.
+*
+*******************************************************************************/
+static inline void _XAie_IOWideFence(u8 NonTemporal)
+{
+	if(NonTemporal != XAIE_ENABLE) {
+		return;
+	}
+#if defined(__x86_64__)
+	_mm_sfence();
+#elif defined(__aarch64__)
+	__asm__ __volatile__("dmb st" : : : "memory");
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API copies a block of words to mapped AIE program or data memory. The
+* words up to the first 16 byte boundary of the destination and after the
+* last one are stored one at a time, the rest with 128-bit stores. Copies of
+* XAIE_IO_NONTEMPORAL_MIN_WORDS words or more use non-temporal stores so that
+* large program and data memory images do not evict the CPU caches.
+*
+* @param	Dest: Mapped address of the first word, 4 byte aligned.
+* @param	Src: Words to copy.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only. The destination shall be memory, see
+*		_XAie_IOCommon_IsMemRange().
+*
+*******************************************************************************/
+void _XAie_IOCommon_MemCopyTo(void *Dest, const u32 *Src, u32 Size)
+{
+	volatile u32 *Ptr = (volatile u32 *)Dest;
+	u8 NonTemporal = (Size >= XAIE_IO_NONTEMPORAL_MIN_WORDS) ?
+		XAIE_ENABLE : XAIE_DISABLE;
+
+	while((Size > 0U) && (((uintptr_t)Ptr & XAIE_IO_WIDE_ALIGN_MASK) != 0U)) {
+		*Ptr++ = *Src++;
+		Size--;
+	}
+
+	while(Size >= XAIE_IO_WIDE_WORDS) {
+		_XAie_IOWideStore(Ptr, Src, NonTemporal);
+		Ptr += XAIE_IO_WIDE_WORDS;
+		Src += XAIE_IO_WIDE_WORDS;
+		Size -= XAIE_IO_WIDE_WORDS;
+	}
+	_XAie_IOWideFence(NonTemporal);
+
+	while(Size > 0U) {
+		*Ptr++ = *Src++;
+		Size--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API copies a block of words from mapped AIE program or data memory
+* using 128-bit loads for the 16 byte aligned part of the source.
+*
+* @param	Dest: Buffer to copy the words to.
+* @param	Src: Mapped address of the first word, 4 byte aligned.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only. The source shall be memory, see
+*		_XAie_IOCommon_IsMemRange().
+*
+*******************************************************************************/
+void _XAie_IOCommon_MemCopyFrom(u32 *Dest, const void *Src, u32 Size)
+{
+	const volatile u32 *Ptr = (const volatile u32 *)Src;
+
+	while((Size > 0U) && (((uintptr_t)Ptr & XAIE_IO_WIDE_ALIGN_MASK) != 0U)) {
+		*Dest++ = *Ptr++;
+		Size--;
+	}
+
+	while(Size >= XAIE_IO_WIDE_WORDS) {
+		_XAie_IOWideLoad(Dest, Ptr);
+		Ptr += XAIE_IO_WIDE_WORDS;
+		Dest += XAIE_IO_WIDE_WORDS;
+		Size -= XAIE_IO_WIDE_WORDS;
+	}
+
+	while(Size > 0U) {
+		*Dest++ = *Ptr++;
+		Size--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API fills a block of mapped AIE program or data memory with a value
+* using 128-bit stores for the 16 byte aligned part of the destination.
+*
+* @param	Dest: Mapped address of the first word, 4 byte aligned.
+* @param	Value: Value to store to each word.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only. The destination shall be memory, see
+*		_XAie_IOCommon_IsMemRange().
+*
+*******************************************************************************/
+void _XAie_IOCommon_MemSet(void *Dest, u32 Value, u32 Size)
+{
+	volatile u32 *Ptr = (volatile u32 *)Dest;
+	const u32 Src[XAIE_IO_WIDE_WORDS] = {Value, Value, Value, Value};
+	u8 NonTemporal = (Size >= XAIE_IO_NONTEMPORAL_MIN_WORDS) ?
+		XAIE_ENABLE : XAIE_DISABLE;
+
+	while((Size > 0U) && (((uintptr_t)Ptr & XAIE_IO_WIDE_ALIGN_MASK) != 0U)) {
+		*Ptr++ = Value;
+		Size--;
+	}
+
+	while(Size >= XAIE_IO_WIDE_WORDS) {
+		_XAie_IOWideStore(Ptr, Src, NonTemporal);
+		Ptr += XAIE_IO_WIDE_WORDS;
+		Size -= XAIE_IO_WIDE_WORDS;
+	}
+	_XAie_IOWideFence(NonTemporal);
+
+	while(Size > 0U) {
+		*Ptr++ = Value;
+		Size--;
+	}
+}
+
 /** @} */
@@ -29,8 +29,17 @@ static inline u64 XAie_IODummyGetTid(void)
 	return 0;
 }
 
+typedef AieRC (*XAie_IOCommonRead32)(void *IOInst, u64 RegOff, u32 *Data);
+
 void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 		XAie_BackendTilesArray *Args);
+AieRC _XAie_IOCommon_MaskPoll(void *IOInst, XAie_IOCommonRead32 Read32,
+		XAie_PollCtx *Poll, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs);
+u8 _XAie_IOCommon_IsMemRange(XAie_DevInst *DevInst, u64 RegOff, u32 Size);
+void _XAie_IOCommon_MemCopyTo(void *Dest, const u32 *Src, u32 Size);
+void _XAie_IOCommon_MemCopyFrom(u32 *Dest, const void *Src, u32 Size);
+void _XAie_IOCommon_MemSet(void *Dest, u32 Value, u32 Size);
 
 #ifndef XAIE_FEATURE_RSC_ENABLE
 static inline AieRC _XAie_RequestRscCommon(XAie_DevInst *DevInst,
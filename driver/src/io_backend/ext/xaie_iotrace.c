@@ -0,0 +1,938 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_iotrace.c
+* @{
+*
+* This file contains the IO trace recorder and replayer. The recorder wraps
+* the IO backend of a device instance and writes every backend call to a
+* binary trace file along with its start time, duration and result. The
+* replayer issues the calls of a trace file to the backend of a device
+* instance, at full speed or with the pacing of the recording, and reports
+* the cost of each type of call on that backend.
+*
+* A trace file starts with a XAie_IOTraceFileHdr followed by records. Each
+* record is a XAie_IOTraceRecord followed by PayloadSize bytes of payload:
+* the data of block writes and block reads, the request of NPI backend
+* operations and the commands of submitted transactions, each a
+* XAie_IOTraceTxnCmd followed by its block write data. All fields are stored
+* in the byte order of the recording host, which is identified by the
+* ByteOrder field of the header. Traces are only replayed on hosts of the
+* same byte order.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+#define _POSIX_C_SOURCE 200112L
+#include <pthread.h>
+#include <time.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_helper.h"
+#include "xaie_io.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_IOTRACE_MAGIC	0x43525449454941ULL	/* "AIEITRC" */
+#define XAIE_IOTRACE_VERSION	2U
+#define XAIE_IOTRACE_BYTE_ORDER	0x01020304U	/* Stored in host order */
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 Magic;
+	u32 Version;
+	u32 BackendType;	/* Backend the trace was recorded on */
+	u32 ByteOrder;		/* XAIE_IOTRACE_BYTE_ORDER */
+	u32 Reserved;
+} XAie_IOTraceFileHdr;
+
+typedef struct {
+	u32 Op;			/* XAie_IOTraceOp */
+	u32 RC;			/* Return code of the call */
+	u64 TimeNs;		/* Start of the call since start of the trace */
+	u64 DurNs;		/* Duration of the call */
+	u64 RegOff;
+	u32 Mask;		/* Mask, or backend operation code of RunOp */
+	u32 Value;		/* Value written, read or polled for */
+	u32 Size;		/* Words of block accesses, timeout of polls or
+				   number of commands of transactions */
+	u32 PayloadSize;	/* Bytes of payload following the record */
+} XAie_IOTraceRecord;
+
+typedef struct {
+	u32 Opcode;
+	u32 Mask;
+	u64 RegOff;
+	u32 Value;
+	u32 Size;		/* Words of block accesses or timeout of polls */
+} XAie_IOTraceTxnCmd;
+
+typedef struct {
+	XAie_Backend Backend;		/* Wrapper of the traced backend */
+	const XAie_Backend *Inner;	/* Traced backend */
+	void *InnerIOInst;
+	FILE *Fp;
+	u64 StartNs;
+#ifdef __linux__
+	pthread_mutex_t Lock;		/* Serializes the records */
+#endif
+} XAie_IOTrace;
+
+/************************** Function Definitions *****************************/
+static inline u64 _XAie_IOTraceNowNs(void)
+{
+#ifdef __linux__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000000U + (u64)Ts.tv_nsec;
+#else
+	return 0U;
+#endif
+}
+
+static inline void _XAie_IOTraceSleepUntilNs(u64 Ns)
+{
+#ifdef __linux__
+	u64 Now = _XAie_IOTraceNowNs();
+	struct timespec Ts;
+
+	if(Ns <= Now) {
+		return;
+	}
+
+	Ts.tv_sec = (time_t)((Ns - Now) / 1000000000U);
+	Ts.tv_nsec = (long)((Ns - Now) % 1000000000U);
+	nanosleep(&Ts, NULL);
+#else
+	(void)Ns;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes a record and its payload to the trace file.
+*
+* @param	Trace: IO trace instance.
+* @param	Rec: Record to write, the start time is absolute.
+* @param	Payload: Payload of the record.
+* @param	PayloadSize: Size of the payload in bytes.
+*
+* @return	None.
+*
+* @note		Internal only. Write failures are reported once the trace is
+*		stopped.
+*
+*******************************************************************************/
+static void _XAie_IOTraceEmit(XAie_IOTrace *Trace, XAie_IOTraceRecord *Rec,
+		const void *Payload, u32 PayloadSize)
+{
+	Rec->TimeNs -= Trace->StartNs;
+	Rec->PayloadSize = PayloadSize;
+
+#ifdef __linux__
+	pthread_mutex_lock(&Trace->Lock);
+#endif
+	fwrite(Rec, sizeof(*Rec), 1U, Trace->Fp);
+	if(PayloadSize > 0U) {
+		fwrite(Payload, PayloadSize, 1U, Trace->Fp);
+	}
+#ifdef __linux__
+	pthread_mutex_unlock(&Trace->Lock);
+#endif
+}
+
+static inline void _XAie_IOTraceInitRec(XAie_IOTraceRecord *Rec,
+		XAie_IOTraceOp Op, u64 RegOff, u32 Mask, u32 Value, u32 Size)
+{
+	Rec->Op = Op;
+	Rec->RegOff = RegOff;
+	Rec->Mask = Mask;
+	Rec->Value = Value;
+	Rec->Size = Size;
+	Rec->TimeNs = _XAie_IOTraceNowNs();
+}
+
+static inline void _XAie_IOTraceEndRec(XAie_IOTraceRecord *Rec, AieRC RC)
+{
+	Rec->DurNs = _XAie_IOTraceNowNs() - Rec->TimeNs;
+	Rec->RC = (u32)RC;
+}
+
+static AieRC _XAie_IOTrace_Finish(void *IOInst)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	AieRC RC;
+
+	RC = Trace->Inner->Ops.Finish(Trace->InnerIOInst);
+	fclose(Trace->Fp);
+#ifdef __linux__
+	pthread_mutex_destroy(&Trace->Lock);
+#endif
+	free(Trace);
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	AieRC RC;
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_WRITE32, RegOff, 0U, Value,
+			1U);
+	RC = Trace->Inner->Ops.Write32(Trace->InnerIOInst, RegOff, Value);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, NULL, 0U);
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	AieRC RC;
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_READ32, RegOff, 0U, 0U, 1U);
+	RC = Trace->Inner->Ops.Read32(Trace->InnerIOInst, RegOff, Data);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	Rec.Value = *Data;
+	_XAie_IOTraceEmit(Trace, &Rec, NULL, 0U);
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	AieRC RC;
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_MASKWRITE32, RegOff, Mask,
+			Value, 1U);
+	RC = Trace->Inner->Ops.MaskWrite32(Trace->InnerIOInst, RegOff, Mask,
+			Value);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, NULL, 0U);
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value, u32 TimeOutUs)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	AieRC RC;
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_MASKPOLL, RegOff, Mask,
+			Value, TimeOutUs);
+	RC = Trace->Inner->Ops.MaskPoll(Trace->InnerIOInst, RegOff, Mask,
+			Value, TimeOutUs);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, NULL, 0U);
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_BlockWrite32(void *IOInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	AieRC RC;
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_BLOCKWRITE32, RegOff, 0U, 0U,
+			Size);
+	RC = Trace->Inner->Ops.BlockWrite32(Trace->InnerIOInst, RegOff, Data,
+			Size);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, Data, Size * (u32)sizeof(u32));
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
+		u32 Size)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	AieRC RC;
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_BLOCKSET32, RegOff, 0U, Data,
+			Size);
+	RC = Trace->Inner->Ops.BlockSet32(Trace->InnerIOInst, RegOff, Data,
+			Size);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, NULL, 0U);
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	AieRC RC;
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_BLOCKREAD32, RegOff, 0U, 0U,
+			Size);
+	RC = Trace->Inner->Ops.BlockRead32(Trace->InnerIOInst, RegOff, Data,
+			Size);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, Data, Size * (u32)sizeof(u32));
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
+		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	AieRC RC;
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_CMDWRITE,
+			((u64)Col << 8U) | Row, CmdWd0, CmdWd1, Command);
+	RC = Trace->Inner->Ops.CmdWrite(Trace->InnerIOInst, Col, Row, Command,
+			CmdWd0, CmdWd1, CmdStr);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, NULL, 0U);
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_RunOp(void *IOInst, XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, void *Arg)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	const void *Payload = NULL;
+	u32 PayloadSize = 0U;
+	AieRC RC;
+
+	/* Only the NPI requests are plain data which can be replayed */
+	if(Op == XAIE_BACKEND_OP_NPIWR32) {
+		Payload = Arg;
+		PayloadSize = sizeof(XAie_BackendNpiWrReq);
+	} else if(Op == XAIE_BACKEND_OP_NPIMASKPOLL32) {
+		Payload = Arg;
+		PayloadSize = sizeof(XAie_BackendNpiMaskPollReq);
+	}
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_RUNOP, 0U, (u32)Op, 0U, 0U);
+	RC = Trace->Inner->Ops.RunOp(Trace->InnerIOInst, DevInst, Op, Arg);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, Payload, PayloadSize);
+
+	return RC;
+}
+
+static AieRC _XAie_IOTrace_SubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
+{
+	XAie_IOTrace *Trace = (XAie_IOTrace *)IOInst;
+	XAie_IOTraceRecord Rec;
+	u32 PayloadSize = 0U;
+	u8 *Payload, *Ptr;
+	AieRC RC;
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		PayloadSize += sizeof(XAie_IOTraceTxnCmd);
+		if(TxnInst->CmdBuf[i].Opcode == XAIE_IO_BLOCKWRITE) {
+			PayloadSize += TxnInst->CmdBuf[i].Size * sizeof(u32);
+		}
+	}
+
+	Payload = (u8 *)malloc(PayloadSize);
+	if(Payload == NULL) {
+		XAIE_WARN("Failed to allocate transaction record, commands "
+				"are not traced\n");
+		PayloadSize = 0U;
+	}
+
+	Ptr = Payload;
+	for(u32 i = 0U; (Payload != NULL) && (i < TxnInst->NumCmds); i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		XAie_IOTraceTxnCmd TCmd;
+
+		TCmd.Opcode = Cmd->Opcode;
+		TCmd.Mask = Cmd->Mask;
+		TCmd.RegOff = Cmd->RegOff;
+		TCmd.Value = Cmd->Value;
+		TCmd.Size = Cmd->Size;
+		if(Cmd->Opcode == XAIE_IO_MASKPOLL) {
+			/* Polls of a transaction run with the default timeout */
+			TCmd.Size = 0U;
+		}
+		memcpy(Ptr, &TCmd, sizeof(TCmd));
+		Ptr += sizeof(TCmd);
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			memcpy(Ptr, (const void *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size * sizeof(u32));
+			Ptr += Cmd->Size * sizeof(u32);
+		}
+	}
+
+	_XAie_IOTraceInitRec(&Rec, XAIE_IOTRACE_OP_SUBMITTXN, 0U, 0U, 0U,
+			TxnInst->NumCmds);
+	RC = Trace->Inner->Ops.SubmitTxn(Trace->InnerIOInst, TxnInst);
+	_XAie_IOTraceEndRec(&Rec, RC);
+	_XAie_IOTraceEmit(Trace, &Rec, Payload, PayloadSize);
+
+	free(Payload);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api starts recording the IO backend calls of a device instance to a
+* trace file. The backend of the device instance is wrapped by the recorder
+* until the trace is stopped or the device instance is finished.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Path - Path of the trace file, overwritten if it exists.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The backend type of the device instance is unchanged while
+*		recording and APIs specific to a backend keep working on the
+*		traced backend.
+*
+******************************************************************************/
+AieRC XAie_IOTraceStart(XAie_DevInst *DevInst, const char *Path)
+{
+	XAie_IOTrace *Trace;
+	XAie_IOTraceFileHdr Hdr;
+	const XAie_Backend *Inner;
+
+	if((DevInst == XAIE_NULL) || (Path == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Inner = DevInst->Backend;
+	if(Inner->Ops.Write32 == _XAie_IOTrace_Write32) {
+		XAIE_ERROR("IO trace is already started\n");
+		return XAIE_ERR;
+	}
+
+	Trace = (XAie_IOTrace *)malloc(sizeof(*Trace));
+	if(Trace == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	Trace->Fp = fopen(Path, "wb");
+	if(Trace->Fp == NULL) {
+		XAIE_ERROR("Failed to open trace file %s\n", Path);
+		free(Trace);
+		return XAIE_ERR;
+	}
+
+	Hdr.Magic = XAIE_IOTRACE_MAGIC;
+	Hdr.Version = XAIE_IOTRACE_VERSION;
+	Hdr.BackendType = (u32)Inner->Type;
+	Hdr.ByteOrder = XAIE_IOTRACE_BYTE_ORDER;
+	Hdr.Reserved = 0U;
+	if(fwrite(&Hdr, sizeof(Hdr), 1U, Trace->Fp) != 1U) {
+		XAIE_ERROR("Failed to write trace file %s\n", Path);
+		fclose(Trace->Fp);
+		free(Trace);
+		return XAIE_ERR;
+	}
+
+#ifdef __linux__
+	pthread_mutex_init(&Trace->Lock, NULL);
+#endif
+	Trace->Inner = Inner;
+	Trace->InnerIOInst = DevInst->IOInst;
+	Trace->StartNs = _XAie_IOTraceNowNs();
+
+	/* Calls which do not take the IO instance are not traced */
+	Trace->Backend = *Inner;
+	Trace->Backend.Ops.Finish = _XAie_IOTrace_Finish;
+	Trace->Backend.Ops.Write32 = _XAie_IOTrace_Write32;
+	Trace->Backend.Ops.Read32 = _XAie_IOTrace_Read32;
+	Trace->Backend.Ops.MaskWrite32 = _XAie_IOTrace_MaskWrite32;
+	Trace->Backend.Ops.MaskPoll = _XAie_IOTrace_MaskPoll;
+	Trace->Backend.Ops.BlockWrite32 = _XAie_IOTrace_BlockWrite32;
+	Trace->Backend.Ops.BlockSet32 = _XAie_IOTrace_BlockSet32;
+	Trace->Backend.Ops.CmdWrite = _XAie_IOTrace_CmdWrite;
+	Trace->Backend.Ops.RunOp = _XAie_IOTrace_RunOp;
+	if(Inner->Ops.SubmitTxn != NULL) {
+		Trace->Backend.Ops.SubmitTxn = _XAie_IOTrace_SubmitTxn;
+	}
+	if(Inner->Ops.BlockRead32 != NULL) {
+		Trace->Backend.Ops.BlockRead32 = _XAie_IOTrace_BlockRead32;
+	}
+
+	DevInst->IOInst = Trace;
+	DevInst->Backend = &Trace->Backend;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api stops recording the IO backend calls of a device instance and
+* restores its backend.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_IOTraceStop(XAie_DevInst *DevInst)
+{
+	XAie_IOTrace *Trace;
+	AieRC RC = XAIE_OK;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->Backend->Ops.Write32 != _XAie_IOTrace_Write32) {
+		XAIE_ERROR("IO trace is not started\n");
+		return XAIE_ERR;
+	}
+
+	Trace = (XAie_IOTrace *)DevInst->IOInst;
+	DevInst->Backend = Trace->Inner;
+	DevInst->IOInst = Trace->InnerIOInst;
+
+	if((ferror(Trace->Fp) != 0) || (fclose(Trace->Fp) != 0)) {
+		XAIE_ERROR("Failed to write trace file\n");
+		RC = XAIE_ERR;
+	}
+#ifdef __linux__
+	pthread_mutex_destroy(&Trace->Lock);
+#endif
+	free(Trace);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api returns the instance of the backend in use by a device instance.
+* While an IO trace is running, DevInst->IOInst points to the trace recorder
+* and the instance of the traced backend is returned instead.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	Pointer to the backend instance.
+*
+* @note		Internal only. Backend specific APIs must use this api instead
+*		of casting DevInst->IOInst.
+*
+******************************************************************************/
+void *_XAie_GetBackendIOInst(XAie_DevInst *DevInst)
+{
+	if(DevInst->Backend->Ops.Write32 == _XAie_IOTrace_Write32) {
+		return ((XAie_IOTrace *)DevInst->IOInst)->InnerIOInst;
+	}
+
+	return DevInst->IOInst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function issues the commands of a recorded transaction to a backend
+* one at a time.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Payload: Commands of the transaction record.
+* @param	PayloadSize: Size of the payload in bytes.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. Commands other than writes, block writes, block
+*		sets and polls are skipped. Polls use the timeout kept in the
+*		record, which is the default timeout transactions poll with.
+*
+*******************************************************************************/
+static AieRC _XAie_IOTraceReplayTxn(XAie_DevInst *DevInst, const u8 *Payload,
+		u32 PayloadSize)
+{
+	const XAie_BackendOps *Ops = &DevInst->Backend->Ops;
+	const u8 *End = Payload + PayloadSize;
+	AieRC RC = XAIE_OK;
+
+	while((Payload + sizeof(XAie_IOTraceTxnCmd) <= End) &&
+			(RC == XAIE_OK)) {
+		XAie_IOTraceTxnCmd Cmd;
+
+		memcpy(&Cmd, Payload, sizeof(Cmd));
+		Payload += sizeof(Cmd);
+
+		switch(Cmd.Opcode) {
+		case XAIE_IO_WRITE:
+			if(Cmd.Mask == 0U) {
+				RC = Ops->Write32(DevInst->IOInst, Cmd.RegOff,
+						Cmd.Value);
+			} else {
+				RC = Ops->MaskWrite32(DevInst->IOInst,
+						Cmd.RegOff, Cmd.Mask,
+						Cmd.Value);
+			}
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			if(Payload + Cmd.Size * sizeof(u32) > End) {
+				return XAIE_ERR;
+			}
+			RC = Ops->BlockWrite32(DevInst->IOInst, Cmd.RegOff,
+					(const u32 *)Payload, Cmd.Size);
+			Payload += Cmd.Size * sizeof(u32);
+			break;
+		case XAIE_IO_BLOCKSET:
+			RC = Ops->BlockSet32(DevInst->IOInst, Cmd.RegOff,
+					Cmd.Value, Cmd.Size);
+			break;
+		case XAIE_IO_MASKPOLL:
+			RC = Ops->MaskPoll(DevInst->IOInst, Cmd.RegOff,
+					Cmd.Mask, Cmd.Value, Cmd.Size);
+			break;
+		default:
+			break;
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a block of registers from the backend of a device
+* instance and compares it with the data of the recording.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset of the block.
+* @param	Expected: Data read during the recording.
+* @param	Size: Number of 32-bit words.
+*
+* @param	Match: Pointer to return XAIE_ENABLE if the data matches.
+*
+* @return	XAIE_OK on success and error code if the read failed.
+*
+* @note		Internal only. Backends without block reads are read one word
+*		at a time.
+*
+*******************************************************************************/
+static AieRC _XAie_IOTraceReplayBlockRead(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Expected, u32 Size, u8 *Match)
+{
+	const XAie_BackendOps *Ops = &DevInst->Backend->Ops;
+	u32 *Data;
+	AieRC RC = XAIE_OK;
+
+	*Match = XAIE_ENABLE;
+	if(Size == 0U) {
+		return XAIE_OK;
+	}
+
+	Data = (u32 *)malloc(Size * sizeof(u32));
+	if(Data == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	if(Ops->BlockRead32 != NULL) {
+		RC = Ops->BlockRead32(DevInst->IOInst, RegOff, Data, Size);
+	} else {
+		for(u32 i = 0U; (i < Size) && (RC == XAIE_OK); i++) {
+			RC = Ops->Read32(DevInst->IOInst, RegOff + i * 4U,
+					&Data[i]);
+		}
+	}
+
+	if((RC == XAIE_OK) &&
+			(memcmp(Data, Expected, Size * sizeof(u32)) != 0)) {
+		*Match = XAIE_DISABLE;
+	}
+	free(Data);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the result of a replayed call against the result of
+* the recording.
+*
+* @param	Rec: Trace record.
+* @param	RC: Result of the replayed call.
+* @param	Stats: Replay statistics to update.
+*
+* @return	XAIE_OK if the call succeeded or failed as in the recording, RC
+*		otherwise.
+*
+* @note		Internal only. Calls which failed during the recording and
+*		succeed on replay are counted as mismatches.
+*
+*******************************************************************************/
+static AieRC _XAie_IOTraceCheckRC(const XAie_IOTraceRecord *Rec, AieRC RC,
+		XAie_IOTraceStats *Stats)
+{
+	if((u32)RC == Rec->RC) {
+		return XAIE_OK;
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Replay of trace operation %u to 0x%lx failed\n",
+				Rec->Op, Rec->RegOff);
+		return RC;
+	}
+
+	Stats->NumMismatches++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function issues a trace record to the backend of a device instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Rec: Trace record.
+* @param	Payload: Payload of the record.
+* @param	Stats: Replay statistics to update.
+*
+* @return	XAIE_OK if the record was replayed, XAIE_FEATURE_NOT_SUPPORTED
+*		if it cannot be replayed and error code if a call which
+*		succeeded during the recording failed.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_IOTraceReplayRec(XAie_DevInst *DevInst,
+		const XAie_IOTraceRecord *Rec, u8 *Payload,
+		XAie_IOTraceStats *Stats)
+{
+	const XAie_BackendOps *Ops = &DevInst->Backend->Ops;
+	void *IOInst = DevInst->IOInst;
+	u32 RegVal;
+	u8 Match;
+	AieRC RC;
+
+	switch(Rec->Op) {
+	case XAIE_IOTRACE_OP_WRITE32:
+		RC = Ops->Write32(IOInst, Rec->RegOff, Rec->Value);
+		break;
+	case XAIE_IOTRACE_OP_READ32:
+		RC = Ops->Read32(IOInst, Rec->RegOff, &RegVal);
+		if((RC == XAIE_OK) && (RegVal != Rec->Value)) {
+			Stats->NumMismatches++;
+		}
+		break;
+	case XAIE_IOTRACE_OP_MASKWRITE32:
+		RC = Ops->MaskWrite32(IOInst, Rec->RegOff, Rec->Mask,
+				Rec->Value);
+		break;
+	case XAIE_IOTRACE_OP_MASKPOLL:
+		/* A poll timing out is a result, not a failure */
+		RC = Ops->MaskPoll(IOInst, Rec->RegOff, Rec->Mask, Rec->Value,
+				Rec->Size);
+		if((u32)RC != Rec->RC) {
+			Stats->NumMismatches++;
+		}
+		return XAIE_OK;
+	case XAIE_IOTRACE_OP_BLOCKWRITE32:
+		if(Rec->PayloadSize != Rec->Size * sizeof(u32)) {
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+		RC = Ops->BlockWrite32(IOInst, Rec->RegOff,
+				(const u32 *)Payload, Rec->Size);
+		break;
+	case XAIE_IOTRACE_OP_BLOCKSET32:
+		RC = Ops->BlockSet32(IOInst, Rec->RegOff, Rec->Value,
+				Rec->Size);
+		break;
+	case XAIE_IOTRACE_OP_BLOCKREAD32:
+		if(Rec->PayloadSize != Rec->Size * sizeof(u32)) {
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+		RC = _XAie_IOTraceReplayBlockRead(DevInst, Rec->RegOff,
+				(const u32 *)Payload, Rec->Size, &Match);
+		if((RC == XAIE_OK) && (Match == XAIE_DISABLE)) {
+			Stats->NumMismatches++;
+		}
+		break;
+	case XAIE_IOTRACE_OP_RUNOP:
+		if(((Rec->Mask != XAIE_BACKEND_OP_NPIWR32) &&
+				(Rec->Mask != XAIE_BACKEND_OP_NPIMASKPOLL32)) ||
+				(Rec->PayloadSize == 0U)) {
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+		RC = Ops->RunOp(IOInst, DevInst, (XAie_BackendOpCode)Rec->Mask,
+				Payload);
+		break;
+	case XAIE_IOTRACE_OP_SUBMITTXN:
+		if((Rec->PayloadSize == 0U) && (Rec->Size > 0U)) {
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+		RC = _XAie_IOTraceReplayTxn(DevInst, Payload,
+				Rec->PayloadSize);
+		break;
+	default:
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	return _XAie_IOTraceCheckRC(Rec, RC, Stats);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api replays a trace file on the IO backend of a device instance. The
+* register accesses of the trace are issued to the backend directly, without
+* going through the transaction or shadow cache layers.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Path - Path of the trace file.
+* @param	Paced - XAIE_ENABLE to issue each call at its recorded time
+*		relative to the start of the replay, XAIE_DISABLE to replay at
+*		full speed.
+* @param	Stats - Pointer to return the replay statistics, may be NULL.
+*		Reads returning a different value and polls returning a
+*		different status than in the trace are counted as mismatches.
+*
+* @return	XAIE_OK on success and error code on failure. The replay
+*		stops at the first call which succeeded during the recording
+*		and fails on the backend of the device instance.
+*
+* @note		Backend operations other than NPI accesses, such as resource
+*		requests, are skipped and counted in NumSkipped. Traces
+*		recorded on a host of a different byte order are rejected.
+*
+******************************************************************************/
+AieRC XAie_IOTraceReplay(XAie_DevInst *DevInst, const char *Path, u8 Paced,
+		XAie_IOTraceStats *Stats)
+{
+	XAie_IOTraceStats LocalStats;
+	XAie_IOTraceFileHdr Hdr;
+	XAie_IOTraceRecord Rec;
+	u8 *Payload = NULL;
+	u32 PayloadCap = 0U;
+	u64 StartNs;
+	AieRC RC = XAIE_OK;
+	FILE *Fp;
+
+	if((DevInst == XAIE_NULL) || (Path == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Stats == NULL) {
+		Stats = &LocalStats;
+	}
+	memset(Stats, 0, sizeof(*Stats));
+
+	Fp = fopen(Path, "rb");
+	if(Fp == NULL) {
+		XAIE_ERROR("Failed to open trace file %s\n", Path);
+		return XAIE_ERR;
+	}
+
+	if((fread(&Hdr, sizeof(Hdr), 1U, Fp) != 1U) ||
+			(Hdr.Magic != XAIE_IOTRACE_MAGIC) ||
+			(Hdr.Version != XAIE_IOTRACE_VERSION)) {
+		XAIE_ERROR("Invalid trace file %s\n", Path);
+		fclose(Fp);
+		return XAIE_ERR;
+	}
+
+	if(Hdr.ByteOrder != XAIE_IOTRACE_BYTE_ORDER) {
+		XAIE_ERROR("Trace file %s was recorded on a host of a "
+				"different byte order\n", Path);
+		fclose(Fp);
+		return XAIE_ERR;
+	}
+
+	StartNs = _XAie_IOTraceNowNs();
+	while(fread(&Rec, sizeof(Rec), 1U, Fp) == 1U) {
+		u64 OpStartNs;
+
+		if(Rec.PayloadSize > PayloadCap) {
+			u8 *Tmp = (u8 *)realloc(Payload, Rec.PayloadSize);
+
+			if(Tmp == NULL) {
+				XAIE_ERROR("Memory allocation failed\n");
+				RC = XAIE_ERR;
+				break;
+			}
+			Payload = Tmp;
+			PayloadCap = Rec.PayloadSize;
+		}
+
+		if((Rec.PayloadSize > 0U) && (fread(Payload, Rec.PayloadSize,
+					1U, Fp) != 1U)) {
+			XAIE_ERROR("Truncated trace file %s\n", Path);
+			RC = XAIE_ERR;
+			break;
+		}
+
+		Stats->NumOps++;
+		if(Rec.Op >= XAIE_IOTRACE_OP_MAX) {
+			Stats->NumSkipped++;
+			continue;
+		}
+
+		if(Paced == XAIE_ENABLE) {
+			_XAie_IOTraceSleepUntilNs(StartNs + Rec.TimeNs);
+		}
+
+		OpStartNs = _XAie_IOTraceNowNs();
+		RC = _XAie_IOTraceReplayRec(DevInst, &Rec, Payload, Stats);
+		if(RC == XAIE_FEATURE_NOT_SUPPORTED) {
+			Stats->NumSkipped++;
+			RC = XAIE_OK;
+			continue;
+		} else if(RC != XAIE_OK) {
+			break;
+		}
+		Stats->OpCount[Rec.Op]++;
+		Stats->OpTotalNs[Rec.Op] += _XAie_IOTraceNowNs() - OpStartNs;
+		Stats->TraceTotalNs[Rec.Op] += Rec.DurNs;
+	}
+
+	free(Payload);
+	fclose(Fp);
+
+	return RC;
+}
+
+/** @} */
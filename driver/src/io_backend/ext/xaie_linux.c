@@ -47,7 +47,8 @@
 #include "xaie_npi.h"
 
 /***************************** Macro Definitions *****************************/
-#define XAIE_128BIT_ALIGN_MASK 0xFF
+#define XAIE_LINUX_WRBUF_MAX_CMDS	1024U	/* Buffered register writes */
+#define XAIE_LINUX_WRBUF_MAX_WORDS	16384U	/* Buffered block write data */
 
 /****************************** Type Definitions *****************************/
 #ifdef __AIELINUX__
@@ -78,6 +79,14 @@ typedef struct XAie_LinuxIO {
 	u8 RowShift;
 	u8 ColShift;
 	u64 BaseAddr;
+	XAie_PollCtx *Poll;	/* Poll settings of the device instance */
+	pthread_mutex_t WrLock;	/* Protects the write buffer */
+	XAie_TxnCmd *WrCmds;	/* Register writes not yet submitted */
+	u32 WrNumCmds;
+	u32 *WrData;		/* Data of the buffered block writes */
+	u32 WrNumWords;
+	u8 WrBatch;		/* XAIE_ENABLE if the writes are buffered,
+				   accessed under WrLock */
 } XAie_LinuxIO;
 
 typedef struct XAie_LinuxMem {
@@ -89,6 +98,317 @@ typedef struct XAie_LinuxMem {
 /************************** Function Definitions *****************************/
 #ifdef __AIELINUX__
 
+/*****************************************************************************/
+/**
+*
+* This function writes a register of the partition with the register ioctl.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	RegOff: Register offset to write.
+* @param	Mask: Mask of the bits to write, 0 to write all the bits.
+* @param	Value: 32-bit value to write.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_RegWrite(XAie_LinuxIO *IOInst, u64 RegOff,
+		u32 Mask, u32 Value)
+{
+	int Ret;
+	struct aie_reg_args Args;
+
+	Args.op = AIE_REG_WRITE;
+	Args.offset = RegOff;
+	Args.val = Value;
+	Args.mask = Mask;
+
+	Ret = ioctl(IOInst->PartitionFd, AIE_REG_IOCTL, &Args);
+	if(Ret < 0) {
+		XAIE_ERROR("Register write failed for offset 0x%lx, %d: %s\n",
+			RegOff, errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function issues register write commands one register at a time.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Cmds: Array of write, block write and block set commands.
+* @param	NumCmds: Number of commands.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_WriteCmds(XAie_LinuxIO *IOInst,
+		const XAie_TxnCmd *Cmds, u32 NumCmds)
+{
+	AieRC RC = XAIE_OK;
+
+	for(u32 i = 0U; (i < NumCmds) && (RC == XAIE_OK); i++) {
+		const XAie_TxnCmd *Cmd = &Cmds[i];
+		const u32 *Data = (const u32 *)(uintptr_t)Cmd->DataPtr;
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			RC = _XAie_LinuxIO_RegWrite(IOInst, Cmd->RegOff,
+					Cmd->Mask, Cmd->Value);
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			for(u32 j = 0U; (j < Cmd->Size) && (RC == XAIE_OK);
+					j++) {
+				RC = _XAie_LinuxIO_RegWrite(IOInst,
+						Cmd->RegOff + j * 4U, 0U,
+						Data[j]);
+			}
+			break;
+		default:
+			for(u32 j = 0U; (j < Cmd->Size) && (RC == XAIE_OK);
+					j++) {
+				RC = _XAie_LinuxIO_RegWrite(IOInst,
+						Cmd->RegOff + j * 4U, 0U,
+						Cmd->Value);
+			}
+			break;
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits register write commands to the kernel driver with a
+* single transaction ioctl. If the kernel driver does not support
+* transactions, the commands are issued one register at a time and the write
+* buffering is disabled for the IO instance.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Cmds: Array of write, block write and block set commands.
+* @param	NumCmds: Number of commands.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_SubmitWrites(XAie_LinuxIO *IOInst,
+		const XAie_TxnCmd *Cmds, u32 NumCmds)
+{
+	int Ret;
+	struct aie_txn_inst Args;
+
+	Args.num_cmds = NumCmds;
+	Args.cmdsptr = (u64)(uintptr_t)Cmds;
+
+	Ret = ioctl(IOInst->PartitionFd, AIE_TRANSACTION_IOCTL, &Args);
+	if(Ret == 0) {
+		return XAIE_OK;
+	}
+
+	if(errno != ENOTTY) {
+		XAIE_ERROR("Submitting %u register writes failed, %d: %s\n",
+			NumCmds, errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	XAIE_DBG("Transactions not supported by the kernel driver, "
+			"disabling write buffering\n");
+	IOInst->WrBatch = XAIE_DISABLE;
+
+	return _XAie_LinuxIO_WriteCmds(IOInst, Cmds, NumCmds);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits the buffered register writes to the kernel driver.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Write lock must be held. The buffer is emptied
+*		even if the submission fails.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_FlushWritesLocked(XAie_LinuxIO *IOInst)
+{
+	AieRC RC;
+
+	if(IOInst->WrNumCmds == 0U) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_LinuxIO_SubmitWrites(IOInst, IOInst->WrCmds,
+			IOInst->WrNumCmds);
+	IOInst->WrNumCmds = 0U;
+	IOInst->WrNumWords = 0U;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits the buffered register writes to the kernel driver. It
+* is called before any access which has to observe the effect of the previous
+* writes, such as register reads, polls, memory mapped accesses and ioctls.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. The buffer is empty if write buffering is
+*		disabled.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_FlushWrites(XAie_LinuxIO *IOInst)
+{
+	AieRC RC;
+
+	pthread_mutex_lock(&IOInst->WrLock);
+	RC = _XAie_LinuxIO_FlushWritesLocked(IOInst);
+	pthread_mutex_unlock(&IOInst->WrLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a register write command to the write buffer of the IO
+* instance. The buffer is submitted first if it cannot hold the command. Block
+* writes larger than the data buffer are submitted immediately with the data
+* of the caller. If write buffering is disabled, the command is issued one
+* register at a time.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Opcode: XAIE_IO_WRITE, XAIE_IO_BLOCKWRITE or XAIE_IO_BLOCKSET.
+* @param	RegOff: Register offset to write.
+* @param	Mask: Mask of the write, 0 to write all the bits.
+* @param	Value: 32-bit value of the write and block set commands.
+* @param	Data: Data of the block write command, NULL otherwise.
+* @param	Size: Number of 32-bit words of block commands.
+*
+* @return	XAIE_OK on success, XAIE_ERR if a submission failed.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_QueueWrite(XAie_LinuxIO *IOInst,
+		XAie_TxnOpcode Opcode, u64 RegOff, u32 Mask, u32 Value,
+		const u32 *Data, u32 Size)
+{
+	AieRC RC = XAIE_OK;
+	XAie_TxnCmd *Cmd;
+	u32 NumWords = (Data != NULL) ? Size : 0U;
+
+	pthread_mutex_lock(&IOInst->WrLock);
+
+	/* Buffering is disabled by a failed submission under the lock */
+	if(IOInst->WrBatch == XAIE_DISABLE) {
+		XAie_TxnCmd WrCmd;
+
+		WrCmd.Opcode = Opcode;
+		WrCmd.Mask = Mask;
+		WrCmd.RegOff = RegOff;
+		WrCmd.Value = Value;
+		WrCmd.DataPtr = (u64)(uintptr_t)Data;
+		WrCmd.Size = Size;
+		RC = _XAie_LinuxIO_WriteCmds(IOInst, &WrCmd, 1U);
+		pthread_mutex_unlock(&IOInst->WrLock);
+		return RC;
+	}
+
+	if((IOInst->WrNumCmds == XAIE_LINUX_WRBUF_MAX_CMDS) ||
+			(IOInst->WrNumWords + NumWords >
+			 XAIE_LINUX_WRBUF_MAX_WORDS)) {
+		RC = _XAie_LinuxIO_FlushWritesLocked(IOInst);
+	}
+
+	if(NumWords > XAIE_LINUX_WRBUF_MAX_WORDS) {
+		XAie_TxnCmd BlkCmd;
+
+		BlkCmd.Opcode = Opcode;
+		BlkCmd.Mask = 0U;
+		BlkCmd.RegOff = RegOff;
+		BlkCmd.Value = 0U;
+		BlkCmd.DataPtr = (u64)(uintptr_t)Data;
+		BlkCmd.Size = Size;
+		if(RC == XAIE_OK) {
+			RC = _XAie_LinuxIO_SubmitWrites(IOInst, &BlkCmd, 1U);
+		}
+		pthread_mutex_unlock(&IOInst->WrLock);
+		return RC;
+	}
+
+	Cmd = &IOInst->WrCmds[IOInst->WrNumCmds++];
+	Cmd->Opcode = Opcode;
+	Cmd->Mask = Mask;
+	Cmd->RegOff = RegOff;
+	Cmd->Value = Value;
+	Cmd->DataPtr = 0U;
+	Cmd->Size = Size;
+	if(NumWords > 0U) {
+		u32 *Dst = &IOInst->WrData[IOInst->WrNumWords];
+
+		memcpy(Dst, Data, NumWords * sizeof(*Dst));
+		Cmd->DataPtr = (u64)(uintptr_t)Dst;
+		IOInst->WrNumWords += NumWords;
+	}
+
+	pthread_mutex_unlock(&IOInst->WrLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function allocates the write buffer of the IO instance. Writes are
+* issued one register at a time if the buffer cannot be allocated.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_LinuxIO_InitWriteBuf(XAie_LinuxIO *IOInst)
+{
+	IOInst->WrNumCmds = 0U;
+	IOInst->WrNumWords = 0U;
+	IOInst->WrBatch = XAIE_DISABLE;
+	IOInst->WrCmds = malloc(XAIE_LINUX_WRBUF_MAX_CMDS *
+			sizeof(*IOInst->WrCmds));
+	IOInst->WrData = malloc(XAIE_LINUX_WRBUF_MAX_WORDS *
+			sizeof(*IOInst->WrData));
+	if((IOInst->WrCmds == NULL) || (IOInst->WrData == NULL) ||
+			(pthread_mutex_init(&IOInst->WrLock, NULL) != 0)) {
+		XAIE_DBG("Failed to allocate write buffer, register writes "
+				"are not buffered\n");
+		free(IOInst->WrCmds);
+		free(IOInst->WrData);
+		IOInst->WrCmds = NULL;
+		IOInst->WrData = NULL;
+		pthread_mutex_init(&IOInst->WrLock, NULL);
+		return;
+	}
+
+	IOInst->WrBatch = XAIE_ENABLE;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -106,6 +426,11 @@ static AieRC XAie_LinuxIO_Finish(void *IOInst)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
 
+	_XAie_LinuxIO_FlushWrites(LinuxIOInst);
+	pthread_mutex_destroy(&LinuxIOInst->WrLock);
+	free(LinuxIOInst->WrCmds);
+	free(LinuxIOInst->WrData);
+
 	munmap(LinuxIOInst->RegMap.VAddr, LinuxIOInst->RegMap.MapSize);
 	munmap(LinuxIOInst->ProgMem.VAddr, LinuxIOInst->ProgMem.MapSize);
 	munmap(LinuxIOInst->DataMem.VAddr, LinuxIOInst->DataMem.MapSize);
@@ -347,8 +672,11 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 		return XAIE_ERR;
 	}
 
+	_XAie_LinuxIO_InitWriteBuf(IOInst);
+
 	DevInst->IOInst = (void *)IOInst;
 	IOInst->DevInst = DevInst;
+	IOInst->Poll = &DevInst->Poll;
 
 	return XAIE_OK;
 }
@@ -369,27 +697,8 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 *******************************************************************************/
 static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 {
-	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
-	int Ret;
-	struct aie_reg_args Args;
-
-	Args.op = AIE_REG_WRITE;
-	Args.offset = RegOff;
-	Args.val = Value;
-	Args.mask = 0; /* mask must be 0 for register write */
-
-	/*
-	 * TBD: Is the check of ioctl call required here? Other backends do not
-	 * check for errors. Kernels prints error messages anyway.
-	 */
-	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_REG_IOCTL, &Args);
-	if(Ret < 0) {
-		XAIE_ERROR("Register write failed for offset 0x%lx, %d: %s\n",
-			RegOff, errno, strerror(errno));
-		return XAIE_ERR;
-	}
-
-	return XAIE_OK;
+	return _XAie_LinuxIO_QueueWrite((XAie_LinuxIO *)IOInst, XAIE_IO_WRITE,
+			RegOff, 0U, Value, NULL, 0U);
 }
 
 /*****************************************************************************/
@@ -409,10 +718,13 @@ static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC;
+
+	RC = _XAie_LinuxIO_FlushWrites(LinuxIOInst);
 
 	*Data = *((u32 *)(LinuxIOInst->RegMap.VAddr + RegOff));
 
-	return XAIE_OK;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -434,27 +746,8 @@ static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
-	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
-	int Ret;
-	struct aie_reg_args Args;
-
-	Args.op = AIE_REG_WRITE;
-	Args.offset = RegOff;
-	Args.val = Value;
-	Args.mask = Mask;
-
-	/*
-	 * TBD: Is the check of ioctl call required here? Other backends do not
-	 * check for errors. Kernels prints error messages anyway.
-	 */
-	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_REG_IOCTL, &Args);
-	if(Ret < 0) {
-		XAIE_ERROR("Register write failed for offset 0x%lx, %d: %s\n",
-			RegOff, errno, strerror(errno));
-		return XAIE_ERR;
-	}
-
-	return XAIE_OK;
+	return _XAie_LinuxIO_QueueWrite((XAie_LinuxIO *)IOInst, XAIE_IO_WRITE,
+			RegOff, Mask, Value, NULL, 0U);
 }
 
 /*****************************************************************************/
@@ -476,34 +769,16 @@ static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_LinuxIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
-
-	while (Count > 0U) {
-		XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			Ret = XAIE_OK;
-			break;
-		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC;
 
-	/* Check for the break from timed-out loop */
-	XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
-	if((Ret == XAIE_ERR) && ((RegVal & Mask) ==
-			 Value)) {
-		Ret = XAIE_OK;
+	RC = _XAie_LinuxIO_FlushWrites(LinuxIOInst);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	return Ret;
+	return _XAie_IOCommon_MaskPoll(IOInst, XAie_LinuxIO_Read32,
+			LinuxIOInst->Poll, RegOff, Mask, Value, TimeOutUs);
 }
 
 /*****************************************************************************/
@@ -596,68 +871,6 @@ static inline u64 _XAie_GetMemOffset(XAie_LinuxIO *IOInst, u8 TileType, u8 Col,
 	return 0;
 }
 
-/*****************************************************************************/
-/**
-*
-* This function copies data to the device using memcpy. The function accepts
-* a 32 bit aligned address. 128bit unaligned addresses are managed within the
-* funtion.
-*
-* @param	Dest: Pointer to the destination address.
-* @param	Src: Pointer to the source buffer.
-* @param	Size: Number of 32-bit words.
-*
-* @return	None.
-*
-* @note		Internal only.
-*
-*******************************************************************************/
-static void _XAie_CopyDataToMem(u32 *Dest, const u32 *Src, u32 Size)
-{
-	u32 StartExtraWrds = 0, EndExtraWrds = 0;
-
-	if((u64)Dest & XAIE_128BIT_ALIGN_MASK) {
-		StartExtraWrds = ((XAIE_128BIT_ALIGN_MASK + 1) -
-				(((u64)Dest) & XAIE_128BIT_ALIGN_MASK)) / 4;
-	}
-
-	if(StartExtraWrds > 0) {
-		for(u8 i = 0; i < StartExtraWrds && Size > 0;  i++) {
-			*Dest = *Src;
-			Dest++;
-			Src++;
-			Size--;
-		}
-	}
-
-	if((u64)(Dest + Size) & XAIE_128BIT_ALIGN_MASK) {
-		EndExtraWrds = (((u64)(Dest + Size)) &
-				XAIE_128BIT_ALIGN_MASK) / 4;
-	}
-
-	if(Size >= (XAIE_128BIT_ALIGN_MASK + 1)) {
-		memcpy((void *)Dest, (void *)Src,
-				(Size - EndExtraWrds) * sizeof(u32));
-		Dest += Size - EndExtraWrds;
-		Src += Size - EndExtraWrds;
-		Size -= Size - EndExtraWrds;
-	}
-
-	if(Size > 0) {
-		for(u8 i = 0; Size > 0; i++) {
-			*Dest = *Src;
-			Dest++;
-			Src++;
-			Size--;
-		}
-	}
-
-	if(Size != 0) {
-		XAIE_ERROR("Copying data to memory failed. %u words not"
-				"written to device\n", Size);
-	}
-}
-
 /*****************************************************************************/
 /**
 *
@@ -688,7 +901,7 @@ static u32* _XAie_GetVirtAddrFromOffset(XAie_LinuxIO *IOInst, u64 RegOff,
 	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MEMTILE) {
 		u64 MemRange = IOInst->MemTileMemAddr + IOInst->MemTileMemSize;
-		if(((RegAddr + Size) < (MemRange)) &&
+		if(((RegAddr + Size * sizeof(u32)) <= MemRange) &&
 				(RegAddr >= IOInst->MemTileMemAddr)) {
 			MemOffset = _XAie_GetMemOffset(IOInst, TileType, Col, Row,
 					IOInst->MemTileMemSize);
@@ -699,14 +912,15 @@ static u32* _XAie_GetVirtAddrFromOffset(XAie_LinuxIO *IOInst, u64 RegOff,
 		}
 	}
 
-	if(((RegAddr + Size) < (IOInst->ProgMemAddr + IOInst->ProgMemSize)) &&
+	if(((RegAddr + Size * sizeof(u32)) <=
+				(IOInst->ProgMemAddr + IOInst->ProgMemSize)) &&
 			(RegAddr >= IOInst->ProgMemAddr)) {
 		/* Handle program memory block write */
 		MemOffset = _XAie_GetMemOffset(IOInst, TileType, Col, Row,
 				IOInst->ProgMemSize);
 		VirtAddr = (u32 *)((char *) IOInst->ProgMem.VAddr + MemOffset +
 				RegAddr - IOInst->ProgMemAddr);
-	} else if(((RegAddr + Size) < (IOInst->DataMemAddr +
+	} else if(((RegAddr + Size * sizeof(u32)) <= (IOInst->DataMemAddr +
 					IOInst->DataMemSize)) &&
 			(RegAddr >= IOInst->DataMemAddr)) {
 		/* Handle data memory block write */
@@ -739,21 +953,22 @@ static AieRC XAie_LinuxIO_BlockWrite32(void *IOInst, u64 RegOff,
 {
 	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
 	u32 *VirtAddr;
+	AieRC RC;
 
 	/* Handle PM and DM sections */
 	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
 	if(VirtAddr != NULL) {
-		_XAie_CopyDataToMem(VirtAddr, Data, Size);
+		RC = _XAie_LinuxIO_FlushWrites(Inst);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		_XAie_IOCommon_MemCopyTo(VirtAddr, Data, Size);
 		return XAIE_OK;
 	}
 
 	/* Handle other registers */
-	for(u32 i = 0; i < Size; i++) {
-		XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U, *Data);
-		Data++;
-	}
-
-	return XAIE_OK;
+	return _XAie_LinuxIO_QueueWrite(Inst, XAIE_IO_BLOCKWRITE, RegOff, 0U,
+			0U, Data, Size);
 }
 
 /*****************************************************************************/
@@ -777,22 +992,63 @@ static AieRC XAie_LinuxIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 {
 	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
 	u32 *VirtAddr;
+	AieRC RC;
 
 	/* Handle PM and DM sections */
 	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
 	if(VirtAddr != NULL) {
-		for(u32 i = 0; i < Size; i++) {
-			*VirtAddr++ = Data;
+		RC = _XAie_LinuxIO_FlushWrites(Inst);
+		if(RC != XAIE_OK) {
+			return RC;
 		}
+		_XAie_IOCommon_MemSet(VirtAddr, Data, Size);
 		return XAIE_OK;
 	}
 
 	/* Handle other registers */
-	for(u32 i = 0; i < Size; i++) {
-		XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U, Data);
+	return _XAie_LinuxIO_QueueWrite(Inst, XAIE_IO_BLOCKSET, RegOff, 0U,
+			Data, NULL, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to the buffer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_LinuxIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
+	const volatile u32 *Addr;
+	u32 *VirtAddr;
+	AieRC RC;
+
+	RC = _XAie_LinuxIO_FlushWrites(Inst);
+
+	/* Handle PM, DM and mem tile sections */
+	VirtAddr = _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
+	if(VirtAddr != NULL) {
+		_XAie_IOCommon_MemCopyFrom(Data, VirtAddr, Size);
+		return RC;
+	}
+
+	/* Handle other registers */
+	Addr = (const volatile u32 *)(Inst->RegMap.VAddr + RegOff);
+	for(u32 i = 0U; i < Size; i++) {
+		Data[i] = Addr[i];
 	}
 
-	return XAIE_OK;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -878,7 +1134,8 @@ static AieRC XAie_LinuxMemAttach(XAie_MemInst *MemInst, u64 MemHandle)
 
 	LinuxMemInst->BufferFd = MemHandle;
 
-	RC = _XAie_LinuxMemAttach((XAie_LinuxIO *)DevInst->IOInst,
+	RC = _XAie_LinuxMemAttach(
+			(XAie_LinuxIO *)_XAie_GetBackendIOInst(DevInst),
 			LinuxMemInst);
 	if(RC != XAIE_OK) {
 		free(LinuxMemInst);
@@ -909,7 +1166,8 @@ static AieRC XAie_LinuxMemDetach(XAie_MemInst *MemInst)
 		(XAie_LinuxMem *)MemInst->BackendHandle;
 	AieRC RC;
 
-	RC = _XAie_LinuxMemDetach((XAie_LinuxIO *)DevInst->IOInst,
+	RC = _XAie_LinuxMemDetach(
+			(XAie_LinuxIO *)_XAie_GetBackendIOInst(DevInst),
 			LinuxMemInst);
 	if(RC != XAIE_OK) {
 		return RC;
@@ -1533,6 +1791,12 @@ static AieRC XAie_LinuxIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 {
 	AieRC RC;
 
+	/* Backend operations are ordered after the buffered writes */
+	RC = _XAie_LinuxIO_FlushWrites((XAie_LinuxIO *)IOInst);
+	if((RC != XAIE_OK) || (Op == XAIE_BACKEND_OP_FLUSH_WRITES)) {
+		return RC;
+	}
+
 	switch(Op) {
 	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
 		return _XAie_LinuxIO_ConfigShimDmaBd(IOInst, Arg);
@@ -1590,6 +1854,12 @@ static AieRC XAie_LinuxSubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
 	int Ret;
 	struct aie_txn_inst Args;
+	AieRC RC;
+
+	RC = _XAie_LinuxIO_FlushWrites(LinuxIOInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
 
 	Args.num_cmds = TxnInst->NumCmds;
 	Args.cmdsptr = (u64)TxnInst->CmdBuf;
@@ -1689,6 +1959,18 @@ static AieRC XAie_LinuxIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_ERR;
 }
 
+static AieRC XAie_LinuxIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static AieRC XAie_LinuxIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		XAie_BackendOpCode Op, void *Arg)
 {
@@ -1784,6 +2066,7 @@ const XAie_Backend LinuxBackend =
 	.Ops.MaskPoll = XAie_LinuxIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_LinuxIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_LinuxIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_LinuxIO_BlockRead32,
 	.Ops.CmdWrite = XAie_LinuxIO_CmdWrite,
 	.Ops.RunOp = XAie_LinuxIO_RunOp,
 	.Ops.MemAllocate = XAie_LinuxMemAllocate,
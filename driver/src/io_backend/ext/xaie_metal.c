@@ -57,6 +57,8 @@ typedef struct XAie_MetalIO {
 	u64 MapSize;
 	void *NpiBaseAddr;
 	u64 NpiMapSize;
+	XAie_PollCtx *Poll;	/* Poll settings of the device instance */
+	XAie_DevInst *DevInst;
 } XAie_MetalIO;
 
 #endif /* __AIEMETAL__ */
@@ -221,6 +223,8 @@ static AieRC XAie_MetalIO_Init(XAie_DevInst *DevInst)
 
 	_XAie_MetalIO_MapNpi(MetalIOInst, XAIE_NPI_BASEADDR);
 
+	MetalIOInst->Poll = &DevInst->Poll;
+	MetalIOInst->DevInst = DevInst;
 	DevInst->IOInst = (void *)MetalIOInst;
 
 	return XAIE_OK;
@@ -325,32 +329,10 @@ static AieRC XAie_MetalIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_MetalIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
-
-	while (Count > 0U) {
-		XAie_MetalIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			return XAIE_OK;
-		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
-
-	/* Check for the break from timed-out loop */
-	XAie_MetalIO_Read32(IOInst, RegOff, &RegVal);
-	if((RegVal & Mask) == Value) {
-		Ret = XAIE_OK;
-	}
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
 
-	return Ret;
+	return _XAie_IOCommon_MaskPoll(IOInst, XAie_MetalIO_Read32,
+			MetalIOInst->Poll, RegOff, Mask, Value, TimeOutUs);
 }
 
 /*****************************************************************************/
@@ -371,9 +353,17 @@ static AieRC XAie_MetalIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value
 static AieRC XAie_MetalIO_BlockWrite32(void *IOInst, u64 RegOff,
 		const u32 *Data, u32 Size)
 {
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
+	volatile u32 *Addr = (volatile u32 *)(MetalIOInst->BaseAddr + RegOff);
+
+	if(_XAie_IOCommon_IsMemRange(MetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_MemCopyTo((void *)(uintptr_t)Addr, Data, Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0; i < Size; i++) {
-		XAie_MetalIO_Write32(IOInst, RegOff + i * 4U, *Data);
-		Data++;
+		Addr[i] = Data[i];
 	}
 
 	return XAIE_OK;
@@ -398,8 +388,53 @@ static AieRC XAie_MetalIO_BlockWrite32(void *IOInst, u64 RegOff,
 static AieRC XAie_MetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 		u32 Size)
 {
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
+	volatile u32 *Addr = (volatile u32 *)(MetalIOInst->BaseAddr + RegOff);
+
+	if(_XAie_IOCommon_IsMemRange(MetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_MemSet((void *)(uintptr_t)Addr, Data, Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0; i < Size; i++) {
-		XAie_MetalIO_Write32(IOInst, RegOff + i * 4U, Data);
+		Addr[i] = Data;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to the buffer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_MetalIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
+	const volatile u32 *Addr =
+		(const volatile u32 *)(MetalIOInst->BaseAddr + RegOff);
+
+	if(_XAie_IOCommon_IsMemRange(MetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_MemCopyFrom(Data, (const void *)(uintptr_t)Addr,
+				Size);
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0U; i < Size; i++) {
+		Data[i] = Addr[i];
 	}
 
 	return XAIE_OK;
@@ -587,6 +622,9 @@ static AieRC XAie_MetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		case XAIE_BACKEND_OP_UPDATE_NPI_ADDR:
 			_XAie_MetalIO_MapNpi(IOInst, *((u64 *)Arg));
 			return XAIE_OK;
+		case XAIE_BACKEND_OP_FLUSH_WRITES:
+			/* Writes are issued immediately */
+			return XAIE_OK;
 		default:
 			RC = XAIE_FEATURE_NOT_SUPPORTED;
 			break;
@@ -685,6 +723,18 @@ static AieRC XAie_MetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_ERR;
 }
 
+static AieRC XAie_MetalIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static AieRC XAie_MetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		XAie_BackendOpCode Op, void *Arg)
 {
@@ -763,6 +813,7 @@ const XAie_Backend MetalBackend =
 	.Ops.MaskPoll = XAie_MetalIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_MetalIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_MetalIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_MetalIO_BlockRead32,
 	.Ops.CmdWrite = XAie_MetalIO_CmdWrite,
 	.Ops.RunOp = XAie_MetalIO_RunOp,
 	.Ops.MemAllocate = XAie_MetalMemAllocate,
@@ -0,0 +1,866 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_regfile.c
+* @{
+*
+* This file contains the data structures and routines for the register file
+* IO backend. The backend does not access any device, it keeps a sparse image
+* of the registers and memories of the partition in host memory. Registers
+* which have never been written read as zero. Status bits can be modelled with
+* a hook called on every register access.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+#include <pthread.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_helper.h"
+#include "xaie_io.h"
+#include "xaie_io_common.h"
+#include "xaie_io_privilege.h"
+#include "xaie_npi.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_REGFILE_PAGE_SHIFT		12U
+#define XAIE_REGFILE_PAGE_WORDS		((1U << XAIE_REGFILE_PAGE_SHIFT) / 4U)
+#define XAIE_REGFILE_INIT_CAPACITY	64U	/* Power of 2 */
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 PageNum;		/* Absolute address >> page shift */
+	u32 *Data;		/* NULL if the slot is empty */
+} XAie_RegFileSlot;
+
+typedef struct {
+	u64 BaseAddr;
+	u64 NpiBaseAddr;
+	XAie_RegFileSlot *Slots;	/* Open addressed page table */
+	u32 Capacity;			/* Number of slots, power of 2 */
+	u32 NumPages;
+	XAie_RegFileSlot *LastSlot;	/* Last page accessed */
+	XAie_RegFileHook Hook;
+	void *HookPriv;
+} XAie_RegFileIO;
+
+/************************** Function Definitions *****************************/
+static inline u32 _XAie_RegFileHash(u64 PageNum, u32 Capacity)
+{
+	return (u32)((PageNum * 0x9E3779B97F4A7C15ULL) >> 32U) &
+		(Capacity - 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks up the page holding an address in the page table.
+*
+* @param	IOInst: Register file IO instance pointer
+* @param	PageNum: Page number of the address.
+*
+* @return	Slot of the page, or the empty slot where the page shall be
+*		inserted.
+*
+* @note		Internal only. The table always has empty slots.
+*
+*******************************************************************************/
+static XAie_RegFileSlot *_XAie_RegFileLookup(XAie_RegFileIO *IOInst,
+		u64 PageNum)
+{
+	u32 Idx = _XAie_RegFileHash(PageNum, IOInst->Capacity);
+
+	while(IOInst->Slots[Idx].Data != NULL) {
+		if(IOInst->Slots[Idx].PageNum == PageNum) {
+			break;
+		}
+		Idx = (Idx + 1U) & (IOInst->Capacity - 1U);
+	}
+
+	return &IOInst->Slots[Idx];
+}
+
+/*****************************************************************************/
+/**
+*
+* This function doubles the number of slots of the page table.
+*
+* @param	IOInst: Register file IO instance pointer
+*
+* @return	XAIE_OK on success, XAIE_ERR on allocation failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_RegFileGrow(XAie_RegFileIO *IOInst)
+{
+	XAie_RegFileSlot *OldSlots = IOInst->Slots;
+	u32 OldCapacity = IOInst->Capacity;
+
+	IOInst->Slots = (XAie_RegFileSlot *)calloc(OldCapacity * 2U,
+			sizeof(*IOInst->Slots));
+	if(IOInst->Slots == NULL) {
+		IOInst->Slots = OldSlots;
+		XAIE_ERROR("Failed to grow register file page table\n");
+		return XAIE_ERR;
+	}
+	IOInst->Capacity = OldCapacity * 2U;
+	IOInst->LastSlot = NULL;
+
+	for(u32 i = 0U; i < OldCapacity; i++) {
+		if(OldSlots[i].Data != NULL) {
+			*_XAie_RegFileLookup(IOInst, OldSlots[i].PageNum) =
+				OldSlots[i];
+		}
+	}
+
+	free(OldSlots);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the page holding an address.
+*
+* @param	IOInst: Register file IO instance pointer
+* @param	Addr: Absolute address.
+* @param	Alloc: XAIE_ENABLE to allocate the page if it is not present.
+*
+* @return	Pointer to the page data, NULL if the page is not present and
+*		not allocated.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 *_XAie_RegFileGetPage(XAie_RegFileIO *IOInst, u64 Addr, u8 Alloc)
+{
+	u64 PageNum = Addr >> XAIE_REGFILE_PAGE_SHIFT;
+	XAie_RegFileSlot *Slot = IOInst->LastSlot;
+
+	if((Slot != NULL) && (Slot->PageNum == PageNum)) {
+		return Slot->Data;
+	}
+
+	Slot = _XAie_RegFileLookup(IOInst, PageNum);
+	if(Slot->Data == NULL) {
+		if(Alloc == XAIE_DISABLE) {
+			return NULL;
+		}
+
+		if((IOInst->NumPages + 1U) * 2U > IOInst->Capacity) {
+			if(_XAie_RegFileGrow(IOInst) != XAIE_OK) {
+				return NULL;
+			}
+			Slot = _XAie_RegFileLookup(IOInst, PageNum);
+		}
+
+		Slot->Data = (u32 *)calloc(XAIE_REGFILE_PAGE_WORDS,
+				sizeof(u32));
+		if(Slot->Data == NULL) {
+			XAIE_ERROR("Failed to allocate register file page\n");
+			return NULL;
+		}
+		Slot->PageNum = PageNum;
+		IOInst->NumPages++;
+	}
+
+	IOInst->LastSlot = Slot;
+
+	return Slot->Data;
+}
+
+static inline u32 _XAie_RegFileWordIdx(u64 Addr)
+{
+	return (u32)(Addr >> 2U) & (XAIE_REGFILE_PAGE_WORDS - 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes words at an absolute address of the register file.
+*
+* @param	IOInst: Register file IO instance pointer
+* @param	Addr: Absolute address of the first word.
+* @param	Data: Words to write, NULL to write Value to every word.
+* @param	Value: Value of the words if Data is NULL.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on allocation failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_RegFileStore(XAie_RegFileIO *IOInst, u64 Addr,
+		const u32 *Data, u32 Value, u32 Size)
+{
+	while(Size > 0U) {
+		u32 Idx = _XAie_RegFileWordIdx(Addr);
+		u32 NumWords = XAIE_REGFILE_PAGE_WORDS - Idx;
+		u32 *Page;
+
+		Page = _XAie_RegFileGetPage(IOInst, Addr, XAIE_ENABLE);
+		if(Page == NULL) {
+			return XAIE_ERR;
+		}
+
+		if(NumWords > Size) {
+			NumWords = Size;
+		}
+
+		if(Data != NULL) {
+			memcpy(&Page[Idx], Data, NumWords * sizeof(u32));
+			Data += NumWords;
+		} else {
+			for(u32 i = 0U; i < NumWords; i++) {
+				Page[Idx + i] = Value;
+			}
+		}
+
+		Addr += (u64)NumWords * 4U;
+		Size -= NumWords;
+	}
+
+	return XAIE_OK;
+}
+
+static inline u32 _XAie_RegFileLoad(XAie_RegFileIO *IOInst, u64 Addr)
+{
+	u32 *Page = _XAie_RegFileGetPage(IOInst, Addr, XAIE_DISABLE);
+
+	return (Page != NULL) ? Page[_XAie_RegFileWordIdx(Addr)] : 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function calls the access hook for the words written at an address.
+*
+* @param	IOInst: Register file IO instance pointer
+* @param	RegOff: Register offset of the first word.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_RegFileHookWrites(XAie_RegFileIO *IOInst, u64 RegOff,
+		u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		u64 Addr = IOInst->BaseAddr + RegOff + i * 4U;
+		u32 *Page = _XAie_RegFileGetPage(IOInst, Addr, XAIE_ENABLE);
+
+		if(Page != NULL) {
+			IOInst->Hook(IOInst->HookPriv, RegOff + i * 4U,
+					&Page[_XAie_RegFileWordIdx(Addr)],
+					XAIE_ENABLE);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to free the global IO instance
+*
+* @param	IOInst: IO Instance pointer.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_Finish(void *IOInst)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+
+	for(u32 i = 0U; i < RegFileIOInst->Capacity; i++) {
+		free(RegFileIOInst->Slots[i].Data);
+	}
+	free(RegFileIOInst->Slots);
+	free(IOInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to initialize the global IO instance
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success. Error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_Init(XAie_DevInst *DevInst)
+{
+	XAie_RegFileIO *IOInst;
+
+	IOInst = (XAie_RegFileIO *)calloc(1U, sizeof(*IOInst));
+	if(IOInst == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	IOInst->Slots = (XAie_RegFileSlot *)calloc(XAIE_REGFILE_INIT_CAPACITY,
+			sizeof(*IOInst->Slots));
+	if(IOInst->Slots == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		free(IOInst);
+		return XAIE_ERR;
+	}
+
+	IOInst->Capacity = XAIE_REGFILE_INIT_CAPACITY;
+	IOInst->BaseAddr = DevInst->BaseAddr;
+	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	DevInst->IOInst = IOInst;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write 32bit data to the specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write.
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, XAIE_ERR on allocation failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+	AieRC RC;
+
+	RC = _XAie_RegFileStore(RegFileIOInst, RegFileIOInst->BaseAddr + RegOff,
+			NULL, Value, 1U);
+	if((RC == XAIE_OK) && (RegFileIOInst->Hook != NULL)) {
+		_XAie_RegFileHookWrites(RegFileIOInst, RegOff, 1U);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read 32bit data from the specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the 32 bit value
+*
+* @return	XAIE_OK on success.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+	u64 Addr = RegFileIOInst->BaseAddr + RegOff;
+	u32 *Page;
+
+	if(RegFileIOInst->Hook == NULL) {
+		*Data = _XAie_RegFileLoad(RegFileIOInst, Addr);
+		return XAIE_OK;
+	}
+
+	Page = _XAie_RegFileGetPage(RegFileIOInst, Addr, XAIE_ENABLE);
+	if(Page == NULL) {
+		return XAIE_ERR;
+	}
+
+	RegFileIOInst->Hook(RegFileIOInst->HookPriv, RegOff,
+			&Page[_XAie_RegFileWordIdx(Addr)], XAIE_DISABLE);
+	*Data = Page[_XAie_RegFileWordIdx(Addr)];
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write masked 32bit data to the specified
+* address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write.
+* @param	Mask: Mask to be applied to Data.
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, XAIE_ERR on allocation failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+	u32 RegVal;
+
+	RegVal = _XAie_RegFileLoad(RegFileIOInst,
+			RegFileIOInst->BaseAddr + RegOff);
+	RegVal = (RegVal & ~Mask) | (Value & Mask);
+
+	return XAie_RegFileIO_Write32(IOInst, RegOff, RegVal);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to mask poll an address for a value.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Mask: Mask to be applied to Data.
+* @param	Value: 32-bit value to poll for
+* @param	TimeOutUs: Timeout in micro seconds.
+*
+* @return	XAIE_OK if the value matches, XAIE_ERR otherwise.
+*
+* @note		Register values only change through the access hook, each read
+*		accounts for 1us of the timeout. Without a hook, the register is
+*		read once.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value, u32 TimeOutUs)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+	u32 NumReads = 1U, RegVal;
+
+	if((RegFileIOInst->Hook != NULL) && (TimeOutUs > 1U)) {
+		NumReads = TimeOutUs;
+	}
+
+	for(u32 i = 0U; i < NumReads; i++) {
+		if(XAie_RegFileIO_Read32(IOInst, RegOff, &RegVal) != XAIE_OK) {
+			return XAIE_ERR;
+		}
+		if((RegVal & Mask) == Value) {
+			return XAIE_OK;
+		}
+	}
+
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write a block of data to aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write.
+* @param	Data: Pointer to the data buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on allocation failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_BlockWrite32(void *IOInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+	AieRC RC;
+
+	RC = _XAie_RegFileStore(RegFileIOInst, RegFileIOInst->BaseAddr + RegOff,
+			Data, 0U, Size);
+	if((RC == XAIE_OK) && (RegFileIOInst->Hook != NULL)) {
+		_XAie_RegFileHookWrites(RegFileIOInst, RegOff, Size);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to initialize a chunk of aie address space with
+* a specified value.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to write.
+* @param	Data: Data to initialize a chunk of aie address space..
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on allocation failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
+		u32 Size)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+	AieRC RC;
+
+	RC = _XAie_RegFileStore(RegFileIOInst, RegFileIOInst->BaseAddr + RegOff,
+			NULL, Data, Size);
+	if((RC == XAIE_OK) && (RegFileIOInst->Hook != NULL)) {
+		_XAie_RegFileHookWrites(RegFileIOInst, RegOff, Size);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to the buffer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on allocation failure.
+*
+* @note		With an access hook, the hook is called for each word.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+	u64 Addr = RegFileIOInst->BaseAddr + RegOff;
+
+	if(RegFileIOInst->Hook != NULL) {
+		for(u32 i = 0U; i < Size; i++) {
+			if(XAie_RegFileIO_Read32(IOInst, RegOff + i * 4U,
+						&Data[i]) != XAIE_OK) {
+				return XAIE_ERR;
+			}
+		}
+
+		return XAIE_OK;
+	}
+
+	while(Size > 0U) {
+		u32 Idx = _XAie_RegFileWordIdx(Addr);
+		u32 NumWords = XAIE_REGFILE_PAGE_WORDS - Idx;
+		u32 *Page;
+
+		if(NumWords > Size) {
+			NumWords = Size;
+		}
+
+		Page = _XAie_RegFileGetPage(RegFileIOInst, Addr, XAIE_DISABLE);
+		if(Page != NULL) {
+			memcpy(Data, &Page[Idx], NumWords * sizeof(u32));
+		} else {
+			memset(Data, 0, NumWords * sizeof(u32));
+		}
+
+		Data += NumWords;
+		Addr += (u64)NumWords * 4U;
+		Size -= NumWords;
+	}
+
+	return XAIE_OK;
+}
+
+static AieRC XAie_RegFileIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
+		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)Col;
+	(void)Row;
+	(void)Command;
+	(void)CmdWd0;
+	(void)CmdWd1;
+	(void)CmdStr;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to mask poll a NPI address for a value.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Mask: Mask to be applied to Data.
+* @param	Value: 32-bit value to poll for
+*
+* @return	XAIE_OK if the value matches, XAIE_ERR otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_RegFileIO_NpiMaskPoll(XAie_RegFileIO *IOInst, u64 RegOff,
+		u32 Mask, u32 Value)
+{
+	u32 RegVal;
+
+	RegVal = _XAie_RegFileLoad(IOInst, IOInst->NpiBaseAddr + RegOff);
+	if((RegVal & Mask) == Value) {
+		return XAIE_OK;
+	}
+
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to run backend operations
+*
+* @param	IOInst: IO instance pointer
+* @param	DevInst: AI engine partition device instance
+* @param	Op: Backend operation code
+* @param	Arg: Backend operation argument
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_RegFileIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, void *Arg)
+{
+	XAie_RegFileIO *RegFileIOInst = (XAie_RegFileIO *)IOInst;
+
+	switch(Op) {
+		case XAIE_BACKEND_OP_NPIWR32:
+		{
+			XAie_BackendNpiWrReq *Req = Arg;
+
+			return _XAie_RegFileStore(RegFileIOInst,
+					RegFileIOInst->NpiBaseAddr +
+					Req->NpiRegOff, NULL, Req->Val, 1U);
+		}
+		case XAIE_BACKEND_OP_NPIMASKPOLL32:
+		{
+			XAie_BackendNpiMaskPollReq *Req = Arg;
+
+			return _XAie_RegFileIO_NpiMaskPoll(RegFileIOInst,
+					Req->NpiRegOff, Req->Mask, Req->Val);
+		}
+		case XAIE_BACKEND_OP_ASSERT_SHIMRST:
+		{
+			u8 RstEnable = (u8)((uintptr_t)Arg & 0xFF);
+
+			_XAie_NpiSetShimReset(DevInst, RstEnable);
+			return XAIE_OK;
+		}
+		case XAIE_BACKEND_OP_SET_PROTREG:
+			return _XAie_NpiSetProtectedRegEnable(DevInst, Arg);
+		case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
+		{
+			XAie_ShimDmaBdArgs *BdArgs = (XAie_ShimDmaBdArgs *)Arg;
+
+			return XAie_RegFileIO_BlockWrite32(IOInst,
+					BdArgs->Addr, BdArgs->BdWords,
+					BdArgs->NumBdWords);
+		}
+		case XAIE_BACKEND_OP_REQUEST_TILES:
+			return _XAie_PrivilegeRequestTiles(DevInst,
+					(XAie_BackendTilesArray *)Arg);
+		case XAIE_BACKEND_OP_REQUEST_RESOURCE:
+			return _XAie_RequestRscCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_RELEASE_RESOURCE:
+			return _XAie_ReleaseRscCommon(Arg);
+		case XAIE_BACKEND_OP_FREE_RESOURCE:
+			return _XAie_FreeRscCommon(Arg);
+		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
+			return _XAie_RequestAllocatedRscCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
+			return _XAie_PrivilegeInitPart(DevInst,
+					(XAie_PartInitOpts *)Arg);
+		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
+			return _XAie_PrivilegeTeardownPart(DevInst);
+		case XAIE_BACKEND_OP_GET_RSC_STAT:
+			return _XAie_GetRscStatCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_UPDATE_NPI_ADDR:
+			RegFileIOInst->NpiBaseAddr = *((u64 *)Arg);
+			return XAIE_OK;
+		case XAIE_BACKEND_OP_FLUSH_WRITES:
+			/* Writes are issued immediately */
+			return XAIE_OK;
+		default:
+			XAIE_ERROR("Register file backend doesn't support "
+					"operation %u.\n", Op);
+			return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to allocate a memory
+*
+* @param	DevInst: Device Instance
+* @param	Size: Size of the memory
+* @param	Cache: Buffer to be cacheable or not
+*
+* @return	Pointer to the allocated memory instance.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_MemInst* XAie_RegFileMemAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache)
+{
+	XAie_MemInst *MemInst;
+
+	(void)Cache;
+
+	MemInst = (XAie_MemInst *)malloc(sizeof(*MemInst));
+	if(MemInst == NULL) {
+		XAIE_ERROR("memory allocation failed\n");
+		return NULL;
+	}
+
+	MemInst->VAddr = (void *)malloc(Size);
+	if(MemInst->VAddr == NULL) {
+		XAIE_ERROR("malloc failed\n");
+		free(MemInst);
+		return NULL;
+	}
+	MemInst->DevAddr = (u64)(uintptr_t)MemInst->VAddr;
+	MemInst->Size = Size;
+	MemInst->DevInst = DevInst;
+
+	return MemInst;
+}
+
+static AieRC XAie_RegFileMemFree(XAie_MemInst *MemInst)
+{
+	free(MemInst->VAddr);
+	free(MemInst);
+
+	return XAIE_OK;
+}
+
+static AieRC XAie_RegFileMemSync(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+
+	return XAIE_OK;
+}
+
+static AieRC XAie_RegFileMemAttach(XAie_MemInst *MemInst, u64 MemHandle)
+{
+	(void)MemInst;
+	(void)MemHandle;
+
+	return XAIE_OK;
+}
+
+static AieRC XAie_RegFileMemDetach(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+
+	return XAIE_OK;
+}
+
+static u64 XAie_RegFileGetTid(void)
+{
+#ifdef __linux__
+	return (u64)pthread_self();
+#else
+	return 0;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This api installs a hook called on every register access of the register
+* file backend. The hook is called with a pointer to the stored register
+* value after every write and before every read, and may update the value to
+* model hardware behaviour, for example setting a DMA done bit after a number
+* of polls.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Hook - Access hook, NULL to remove the hook.
+* @param	Priv - Private data passed to the hook.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Polls of the register file backend read the register once per
+*		micro second of timeout when a hook is installed, and once
+*		otherwise. NPI registers are not passed to the hook.
+*
+******************************************************************************/
+AieRC XAie_RegFileSetHook(XAie_DevInst *DevInst, XAie_RegFileHook Hook,
+		void *Priv)
+{
+	XAie_RegFileIO *IOInst;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->Backend->Type != XAIE_IO_BACKEND_REGFILE) {
+		XAIE_ERROR("Register file backend is not in use\n");
+		return XAIE_INVALID_BACKEND;
+	}
+
+	IOInst = (XAie_RegFileIO *)_XAie_GetBackendIOInst(DevInst);
+	IOInst->Hook = Hook;
+	IOInst->HookPriv = Priv;
+
+	return XAIE_OK;
+}
+
+const XAie_Backend RegFileBackend =
+{
+	.Type = XAIE_IO_BACKEND_REGFILE,
+	.Ops.Init = XAie_RegFileIO_Init,
+	.Ops.Finish = XAie_RegFileIO_Finish,
+	.Ops.Write32 = XAie_RegFileIO_Write32,
+	.Ops.Read32 = XAie_RegFileIO_Read32,
+	.Ops.MaskWrite32 = XAie_RegFileIO_MaskWrite32,
+	.Ops.MaskPoll = XAie_RegFileIO_MaskPoll,
+	.Ops.BlockWrite32 = XAie_RegFileIO_BlockWrite32,
+	.Ops.BlockSet32 = XAie_RegFileIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_RegFileIO_BlockRead32,
+	.Ops.CmdWrite = XAie_RegFileIO_CmdWrite,
+	.Ops.RunOp = XAie_RegFileIO_RunOp,
+	.Ops.MemAllocate = XAie_RegFileMemAllocate,
+	.Ops.MemFree = XAie_RegFileMemFree,
+	.Ops.MemSyncForCPU = XAie_RegFileMemSync,
+	.Ops.MemSyncForDev = XAie_RegFileMemSync,
+	.Ops.MemAttach = XAie_RegFileMemAttach,
+	.Ops.MemDetach = XAie_RegFileMemDetach,
+	.Ops.GetTid = XAie_RegFileGetTid,
+	.Ops.SubmitTxn = NULL,
+};
+
+/** @} */
@@ -432,6 +432,9 @@ static AieRC XAie_SimIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		SimIOInst->NpiBaseAddr = *((u64 *)Arg);
 		break;
 	}
+	case XAIE_BACKEND_OP_FLUSH_WRITES:
+		/* Writes are issued immediately */
+		return XAIE_OK;
 	default:
 		XAIE_ERROR("Simulation backend doesn't support operation %d\n",
 				Op);
@@ -28,6 +28,7 @@
 
 #include <errno.h>
 #include <netdb.h>
+#include <poll.h>
 #include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -48,6 +49,30 @@
 #define XAIE_IO_SOCKET_CMDBUFSIZE	48U
 #define XAIE_IO_SOCKET_RDBUFSIZE	11U /* "0xDEADBEEF\n" */
 
+/*
+ * Binary protocol, selected with XAIE_SOCKET_PROTOCOL=binary. Each message is
+ * a sequence of little endian 32-bit words: total size of the message in
+ * bytes, opcode, low and high words of the address, opcode arguments and block
+ * write data. Only reads and polls are acknowledged, with a single little
+ * endian 32-bit word.
+ */
+#define XAIE_IO_SOCKET_PROTOCOL_ENV	"XAIE_SOCKET_PROTOCOL"
+#define XAIE_IO_SOCKET_BIN_VERSION	1U
+#define XAIE_IO_SOCKET_HELLO_TIMEOUT_MS	1000
+#define XAIE_IO_SOCKET_TXBUFSIZE	65536U
+#define XAIE_IO_SOCKET_MSG_HDR_WORDS	4U	/* Size, opcode and address */
+#define XAIE_IO_SOCKET_MSG_MAX_ARGS	3U
+#define XAIE_IO_SOCKET_MAX_PIPELINED_RD	1024U	/* Reads sent before the
+						   replies are received */
+
+#define XAIE_IO_SOCKET_MSG_WRITE	1U	/* Value */
+#define XAIE_IO_SOCKET_MSG_MASKWRITE	2U	/* Mask, value */
+#define XAIE_IO_SOCKET_MSG_BLOCKWRITE	3U	/* Number of words, data */
+#define XAIE_IO_SOCKET_MSG_BLOCKSET	4U	/* Value, number of words */
+#define XAIE_IO_SOCKET_MSG_READ		5U	/* Replies the value */
+#define XAIE_IO_SOCKET_MSG_MASKPOLL	6U	/* Mask, value, timeout in us,
+						   replies 0 on success */
+
 /****************************** Type Definitions *****************************/
 #ifdef __AIESOCKET__
 
@@ -55,12 +80,373 @@ typedef struct XAie_SocketIO {
 	u64 BaseAddr;
 	u64 NpiBaseAddr;
 	int SocketFd;
+	XAie_PollCtx *Poll;	/* Poll settings of the device instance */
+	u8 Binary;		/* XAIE_ENABLE if binary protocol is used */
+	pthread_mutex_t TxLock;	/* Protects the transmit buffer */
+	u32 *TxBuf;		/* Binary messages not sent yet */
+	u32 TxLen;		/* Number of words in the transmit buffer */
 } XAie_SocketIO;
 
 #endif /* __AIESOCKET__ */
 /************************** Function Definitions *****************************/
 #ifdef __AIESOCKET__
 
+/*****************************************************************************/
+/**
+*
+* This function converts a word between the host byte order and the little
+* endian byte order of the binary protocol. The conversion is its own inverse.
+*
+* @param	Value: Word to convert.
+*
+* @return	Converted word.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_SocketIO_Le32(u32 Value)
+{
+	u32 Word;
+	u8 *Bytes = (u8 *)&Word;
+
+	Bytes[0U] = (u8)(Value & 0xFFU);
+	Bytes[1U] = (u8)((Value >> 8U) & 0xFFU);
+	Bytes[2U] = (u8)((Value >> 16U) & 0xFFU);
+	Bytes[3U] = (u8)((Value >> 24U) & 0xFFU);
+
+	return Word;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends a buffer over the socket, retrying on partial writes.
+*
+* @param	Fd: Socket file descriptor.
+* @param	Buf: Buffer to send.
+* @param	Len: Number of bytes to send.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_SendAll(int Fd, const void *Buf, size_t Len)
+{
+	const char *Ptr = (const char *)Buf;
+
+	while(Len > 0U) {
+		ssize_t Ret = write(Fd, Ptr, Len);
+
+		if(Ret < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			XAIE_ERROR("Failed to write to socket, %d: %s\n",
+					errno, strerror(errno));
+			return XAIE_ERR;
+		}
+		Ptr += Ret;
+		Len -= (size_t)Ret;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function receives a buffer from the socket, retrying on partial reads.
+*
+* @param	Fd: Socket file descriptor.
+* @param	Buf: Buffer to receive to.
+* @param	Len: Number of bytes to receive.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_RecvAll(int Fd, void *Buf, size_t Len)
+{
+	char *Ptr = (char *)Buf;
+
+	while(Len > 0U) {
+		ssize_t Ret = read(Fd, Ptr, Len);
+
+		if(Ret < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			XAIE_ERROR("Failed to read from socket, %d: %s\n",
+					errno, strerror(errno));
+			return XAIE_ERR;
+		}
+		if(Ret == 0) {
+			XAIE_ERROR("Socket closed by the simulator\n");
+			return XAIE_ERR;
+		}
+		Ptr += Ret;
+		Len -= (size_t)Ret;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends the binary messages of the transmit buffer.
+*
+* @param	IOInst: Socket IO instance pointer
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Transmit lock must be held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_FlushLocked(XAie_SocketIO *IOInst)
+{
+	AieRC RC;
+
+	if(IOInst->TxLen == 0U) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_SocketIO_SendAll(IOInst->SocketFd, IOInst->TxBuf,
+			IOInst->TxLen * sizeof(u32));
+	IOInst->TxLen = 0U;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function appends a binary message to the transmit buffer. The buffer
+* is sent first if it cannot hold the message.
+*
+* @param	IOInst: Socket IO instance pointer
+* @param	Op: Message opcode.
+* @param	Addr: Absolute address of the access.
+* @param	Args: Arguments of the message, NULL if there is none.
+* @param	NumArgs: Number of arguments.
+* @param	Data: Block write data, NULL for other messages.
+* @param	NumData: Number of words of block write data.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Transmit lock must be held. The message shall
+*		fit in the transmit buffer.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_QueueLocked(XAie_SocketIO *IOInst, u32 Op,
+		u64 Addr, const u32 *Args, u32 NumArgs, const u32 *Data,
+		u32 NumData)
+{
+	u32 NumWords = XAIE_IO_SOCKET_MSG_HDR_WORDS + NumArgs + NumData;
+	u32 *Msg;
+
+	if(IOInst->TxLen + NumWords > XAIE_IO_SOCKET_TXBUFSIZE / sizeof(u32)) {
+		AieRC RC = _XAie_SocketIO_FlushLocked(IOInst);
+
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	Msg = &IOInst->TxBuf[IOInst->TxLen];
+	Msg[0] = _XAie_SocketIO_Le32(NumWords * (u32)sizeof(u32));
+	Msg[1] = _XAie_SocketIO_Le32(Op);
+	Msg[2] = _XAie_SocketIO_Le32((u32)(Addr & 0xFFFFFFFFU));
+	Msg[3] = _XAie_SocketIO_Le32((u32)(Addr >> 32U));
+	Msg += XAIE_IO_SOCKET_MSG_HDR_WORDS;
+	for(u32 i = 0U; i < NumArgs; i++) {
+		Msg[i] = _XAie_SocketIO_Le32(Args[i]);
+	}
+	Msg += NumArgs;
+	for(u32 i = 0U; i < NumData; i++) {
+		Msg[i] = _XAie_SocketIO_Le32(Data[i]);
+	}
+	IOInst->TxLen += NumWords;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a binary message which is not acknowledged by the
+* simulator. The message is sent with the next read or when the transmit
+* buffer is full.
+*
+* @param	IOInst: Socket IO instance pointer
+* @param	Op: Message opcode.
+* @param	Addr: Absolute address of the access.
+* @param	Args: Arguments of the message.
+* @param	NumArgs: Number of arguments.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_BinPost(XAie_SocketIO *IOInst, u32 Op, u64 Addr,
+		const u32 *Args, u32 NumArgs)
+{
+	AieRC RC;
+
+	pthread_mutex_lock(&IOInst->TxLock);
+	RC = _XAie_SocketIO_QueueLocked(IOInst, Op, Addr, Args, NumArgs, NULL,
+			0U);
+	pthread_mutex_unlock(&IOInst->TxLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends a binary message along with all the queued messages and
+* waits for its reply.
+*
+* @param	IOInst: Socket IO instance pointer
+* @param	Op: Message opcode.
+* @param	Addr: Absolute address of the access.
+* @param	Args: Arguments of the message.
+* @param	NumArgs: Number of arguments.
+* @param	Reply: Pointer to return the reply word.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_BinRequest(XAie_SocketIO *IOInst, u32 Op,
+		u64 Addr, const u32 *Args, u32 NumArgs, u32 *Reply)
+{
+	AieRC RC;
+
+	pthread_mutex_lock(&IOInst->TxLock);
+	RC = _XAie_SocketIO_QueueLocked(IOInst, Op, Addr, Args, NumArgs, NULL,
+			0U);
+	if(RC == XAIE_OK) {
+		RC = _XAie_SocketIO_FlushLocked(IOInst);
+	}
+	if(RC == XAIE_OK) {
+		RC = _XAie_SocketIO_RecvAll(IOInst->SocketFd, Reply,
+				sizeof(*Reply));
+		*Reply = _XAie_SocketIO_Le32(*Reply);
+	}
+	pthread_mutex_unlock(&IOInst->TxLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function switches the connection to the binary protocol if it is
+* requested with the XAIE_SOCKET_PROTOCOL environment variable and supported
+* by the simulator. The request is sent as a text command, simulators which
+* do not reply to it within a second keep using the text protocol.
+*
+* @param	IOInst: Socket IO instance pointer
+*
+* @return	XAIE_OK if the connection can be used, XAIE_ERR if the request
+*		was sent without receiving its whole reply. A late reply would
+*		then be taken as the reply of a later read, the connection
+*		shall not be used anymore.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_SelectProtocol(XAie_SocketIO *IOInst)
+{
+	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
+	char RdBuf[XAIE_IO_SOCKET_RDBUFSIZE + 1U];
+	const char *Protocol = getenv(XAIE_IO_SOCKET_PROTOCOL_ENV);
+	struct pollfd Pfd;
+
+	IOInst->Binary = XAIE_DISABLE;
+	IOInst->TxLen = 0U;
+	IOInst->TxBuf = NULL;
+	pthread_mutex_init(&IOInst->TxLock, NULL);
+
+	if((Protocol == NULL) || (strcmp(Protocol, "binary") != 0)) {
+		return XAIE_OK;
+	}
+
+	IOInst->TxBuf = (u32 *)malloc(XAIE_IO_SOCKET_TXBUFSIZE);
+	if(IOInst->TxBuf == NULL) {
+		XAIE_WARN("Failed to allocate transmit buffer, using text "
+				"protocol\n");
+		return XAIE_OK;
+	}
+
+	sprintf(CmdBuf, "B 0X%08X\n", XAIE_IO_SOCKET_BIN_VERSION);
+	if(_XAie_SocketIO_SendAll(IOInst->SocketFd, CmdBuf,
+				strlen(CmdBuf)) != XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	Pfd.fd = IOInst->SocketFd;
+	Pfd.events = POLLIN;
+	if((poll(&Pfd, 1U, XAIE_IO_SOCKET_HELLO_TIMEOUT_MS) != 1) ||
+			(_XAie_SocketIO_RecvAll(IOInst->SocketFd, RdBuf,
+				XAIE_IO_SOCKET_RDBUFSIZE) != XAIE_OK)) {
+		XAIE_WARN("Simulator does not support binary protocol, using "
+				"text protocol\n");
+		return XAIE_ERR;
+	}
+
+	RdBuf[XAIE_IO_SOCKET_RDBUFSIZE] = '\0';
+	if((u32)strtoul(RdBuf, NULL, 0) != XAIE_IO_SOCKET_BIN_VERSION) {
+		XAIE_WARN("Simulator does not support binary protocol version "
+				"%u, using text protocol\n",
+				XAIE_IO_SOCKET_BIN_VERSION);
+		return XAIE_OK;
+	}
+
+	XAIE_DBG("Using binary socket protocol version %u\n",
+			XAIE_IO_SOCKET_BIN_VERSION);
+	IOInst->Binary = XAIE_ENABLE;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function connects to the first reachable address of a list.
+*
+* @param	List: Addresses of the simulator.
+*
+* @return	Socket file descriptor on success, -1 on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static int _XAie_SocketIO_Connect(const struct addrinfo *List)
+{
+	const struct addrinfo *p;
+	int SocketFd;
+
+	for(p = List; p != NULL; p = p->ai_next) {
+
+		SocketFd = socket(p->ai_family, p->ai_socktype, p->ai_protocol);
+		if(SocketFd < 0)
+			continue;
+
+		if(connect(SocketFd, p->ai_addr, p->ai_addrlen) != -1)
+			return SocketFd;
+
+		close(SocketFd);
+	}
+
+	return -1;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -78,6 +464,14 @@ static AieRC XAie_SocketIO_Finish(void *IOInst)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
 
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		pthread_mutex_lock(&SocketIOInst->TxLock);
+		_XAie_SocketIO_FlushLocked(SocketIOInst);
+		pthread_mutex_unlock(&SocketIOInst->TxLock);
+	}
+
+	pthread_mutex_destroy(&SocketIOInst->TxLock);
+	free(SocketIOInst->TxBuf);
 	close(SocketIOInst->SocketFd);
 	free(IOInst);
 
@@ -100,7 +494,7 @@ static AieRC XAie_SocketIO_Finish(void *IOInst)
 static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 {
 	XAie_SocketIO *IOInst;
-	struct addrinfo hints, *slist, *p;
+	struct addrinfo hints, *slist;
 	u32 FileSize;
 	char *PortNum;
 	int ret;
@@ -168,20 +562,8 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 		return XAIE_ERR;
 	}
 
-	for(p = slist; p != NULL; p = p->ai_next) {
-
-		SocketFd = socket(p->ai_family, p->ai_socktype, p->ai_protocol);
-		if(SocketFd < 0)
-			continue;
-
-		ret = connect(SocketFd, p->ai_addr, p->ai_addrlen);
-		if(ret != -1)
-			break;
-
-		close(SocketFd);
-	}
-
-	if(p == NULL) {
+	SocketFd = _XAie_SocketIO_Connect(slist);
+	if(SocketFd < 0) {
 		XAIE_ERROR("failed to connect to sim\n");
 		return XAIE_ERR;
 	}
@@ -189,6 +571,21 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 	IOInst->SocketFd = SocketFd;
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst->Poll = &DevInst->Poll;
+	if(_XAie_SocketIO_SelectProtocol(IOInst) != XAIE_OK) {
+		/* Drop the reply which may still arrive on the old connection */
+		close(IOInst->SocketFd);
+		IOInst->SocketFd = _XAie_SocketIO_Connect(slist);
+		if(IOInst->SocketFd < 0) {
+			XAIE_ERROR("failed to reconnect to sim\n");
+			pthread_mutex_destroy(&IOInst->TxLock);
+			free(IOInst->TxBuf);
+			free(IOInst);
+			freeaddrinfo(slist);
+			free(PortNum);
+			return XAIE_ERR;
+		}
+	}
 	DevInst->IOInst = IOInst;
 
 	freeaddrinfo(slist);
@@ -216,6 +613,12 @@ static AieRC XAie_SocketIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
 	size_t Len;
 
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		return _XAie_SocketIO_BinPost(SocketIOInst,
+				XAIE_IO_SOCKET_MSG_WRITE,
+				SocketIOInst->BaseAddr + RegOff, &Value, 1U);
+	}
+
 	sprintf(CmdBuf, "W 0X%016lX 0X%08X\n", SocketIOInst->BaseAddr + RegOff,
 			Value);
 	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
@@ -251,6 +654,13 @@ static AieRC XAie_SocketIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	size_t Len;
 	int Ret;
 
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		return _XAie_SocketIO_BinRequest(SocketIOInst,
+				XAIE_IO_SOCKET_MSG_READ,
+				SocketIOInst->BaseAddr + RegOff, NULL, 0U,
+				Data);
+	}
+
 	sprintf(CmdBuf, "R 0X%016lX\n", SocketIOInst->BaseAddr + RegOff);
 	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
 	if(Len != strlen(CmdBuf)) {
@@ -292,9 +702,18 @@ static AieRC XAie_SocketIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 static AieRC XAie_SocketIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
 	AieRC RC;
 	u32 RegVal;
 
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		u32 Args[2U] = {Mask, Value};
+
+		return _XAie_SocketIO_BinPost(SocketIOInst,
+				XAIE_IO_SOCKET_MSG_MASKWRITE,
+				SocketIOInst->BaseAddr + RegOff, Args, 2U);
+	}
+
 	RC = XAie_SocketIO_Read32(IOInst, RegOff, &RegVal);
 	if(RC != XAIE_OK) {
 		return RC;
@@ -325,32 +744,26 @@ static AieRC XAie_SocketIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_SocketIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value, u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
 
-	while (Count > 0U) {
-		XAie_SocketIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			return XAIE_OK;
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		u32 Args[3U] = {Mask, Value, TimeOutUs};
+		u32 Status;
+		AieRC RC;
+
+		RC = _XAie_SocketIO_BinRequest(SocketIOInst,
+				XAIE_IO_SOCKET_MSG_MASKPOLL,
+				SocketIOInst->BaseAddr + RegOff, Args, 3U,
+				&Status);
+		if(RC != XAIE_OK) {
+			return RC;
 		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
 
-	/* Check for the break from timed-out loop */
-	XAie_SocketIO_Read32(IOInst, RegOff, &RegVal);
-	if((RegVal & Mask) == Value) {
-		Ret = XAIE_OK;
+		return (Status == 0U) ? XAIE_OK : XAIE_ERR;
 	}
 
-	return Ret;
+	return _XAie_IOCommon_MaskPoll(IOInst, XAie_SocketIO_Read32,
+			SocketIOInst->Poll, RegOff, Mask, Value, TimeOutUs);
 }
 
 /*****************************************************************************/
@@ -371,6 +784,31 @@ static AieRC XAie_SocketIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_SocketIO_BlockWrite32(void *IOInst, u64 RegOff,
 		const u32 *Data, u32 Size)
 {
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		u32 MaxWords = XAIE_IO_SOCKET_TXBUFSIZE / sizeof(u32) -
+			XAIE_IO_SOCKET_MSG_HDR_WORDS - 1U;
+		AieRC RC = XAIE_OK;
+
+		/* Split the block in messages fitting the transmit buffer */
+		pthread_mutex_lock(&SocketIOInst->TxLock);
+		while((Size > 0U) && (RC == XAIE_OK)) {
+			u32 NumWords = (Size < MaxWords) ? Size : MaxWords;
+
+			RC = _XAie_SocketIO_QueueLocked(SocketIOInst,
+					XAIE_IO_SOCKET_MSG_BLOCKWRITE,
+					SocketIOInst->BaseAddr + RegOff,
+					&NumWords, 1U, Data, NumWords);
+			RegOff += NumWords * 4U;
+			Data += NumWords;
+			Size -= NumWords;
+		}
+		pthread_mutex_unlock(&SocketIOInst->TxLock);
+
+		return RC;
+	}
+
 	for(u32 i = 0U; i < Size; i++) {
 		XAie_SocketIO_Write32(IOInst, RegOff + i * 4U, *Data);
 		Data++;
@@ -398,12 +836,85 @@ static AieRC XAie_SocketIO_BlockWrite32(void *IOInst, u64 RegOff,
 static AieRC XAie_SocketIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 		u32 Size)
 {
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		u32 Args[2U] = {Data, Size};
+
+		return _XAie_SocketIO_BinPost(SocketIOInst,
+				XAIE_IO_SOCKET_MSG_BLOCKSET,
+				SocketIOInst->BaseAddr + RegOff, Args, 2U);
+	}
+
 	for(u32 i = 0U; i < Size; i++)
 		XAie_SocketIO_Write32(IOInst, RegOff+ i * 4U, Data);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie. With the
+* binary protocol, the reads of a block are sent in batches and their replies
+* received together, so a block costs one round trip per batch rather than
+* one per word.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to the buffer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_SocketIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	AieRC RC = XAIE_OK;
+
+	if(SocketIOInst->Binary != XAIE_ENABLE) {
+		for(u32 i = 0U; (i < Size) && (RC == XAIE_OK); i++) {
+			RC = XAie_SocketIO_Read32(IOInst, RegOff + i * 4U,
+					&Data[i]);
+		}
+
+		return RC;
+	}
+
+	pthread_mutex_lock(&SocketIOInst->TxLock);
+	while((Size > 0U) && (RC == XAIE_OK)) {
+		u32 NumWords = (Size < XAIE_IO_SOCKET_MAX_PIPELINED_RD) ? Size :
+			XAIE_IO_SOCKET_MAX_PIPELINED_RD;
+
+		for(u32 i = 0U; (i < NumWords) && (RC == XAIE_OK); i++) {
+			RC = _XAie_SocketIO_QueueLocked(SocketIOInst,
+					XAIE_IO_SOCKET_MSG_READ,
+					SocketIOInst->BaseAddr + RegOff +
+					i * 4U, NULL, 0U, NULL, 0U);
+		}
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_FlushLocked(SocketIOInst);
+		}
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_RecvAll(SocketIOInst->SocketFd,
+					Data, NumWords * sizeof(u32));
+		}
+		for(u32 i = 0U; (i < NumWords) && (RC == XAIE_OK); i++) {
+			Data[i] = _XAie_SocketIO_Le32(Data[i]);
+		}
+		RegOff += NumWords * 4U;
+		Data += NumWords;
+		Size -= NumWords;
+	}
+	pthread_mutex_unlock(&SocketIOInst->TxLock);
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -424,6 +935,13 @@ static void _XAie_SocketIO_NpiWrite32(void *IOInst, u32 RegOff, u32 RegVal)
 	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
 	size_t Len;
 
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		_XAie_SocketIO_BinPost(SocketIOInst, XAIE_IO_SOCKET_MSG_WRITE,
+				SocketIOInst->NpiBaseAddr + RegOff, &RegVal,
+				1U);
+		return;
+	}
+
 	sprintf(CmdBuf, "W 0X%016lX 0X%08X\n",
 			SocketIOInst->NpiBaseAddr + RegOff, RegVal);
 	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
@@ -458,6 +976,13 @@ static AieRC _XAie_SocketIO_NpiRead32(void *IOInst, u64 RegOff, u32 *Data)
 	size_t Len;
 	int Ret;
 
+	if(SocketIOInst->Binary == XAIE_ENABLE) {
+		return _XAie_SocketIO_BinRequest(SocketIOInst,
+				XAIE_IO_SOCKET_MSG_READ,
+				SocketIOInst->NpiBaseAddr + RegOff, NULL, 0U,
+				Data);
+	}
+
 	sprintf(CmdBuf, "R 0X%016lX\n", SocketIOInst->NpiBaseAddr + RegOff);
 	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
 	if(Len != strlen(CmdBuf)) {
@@ -580,6 +1105,17 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		case XAIE_BACKEND_OP_UPDATE_NPI_ADDR:
 			XAIE_WARN("NPI address cannot be updated for socket backend. Ignoring request.\n");
 			return XAIE_OK;
+		case XAIE_BACKEND_OP_FLUSH_WRITES:
+		{
+			XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+			AieRC RC;
+
+			pthread_mutex_lock(&SocketIOInst->TxLock);
+			RC = _XAie_SocketIO_FlushLocked(SocketIOInst);
+			pthread_mutex_unlock(&SocketIOInst->TxLock);
+
+			return RC;
+		}
 		default:
 			XAIE_ERROR("Socket backend does not support operation "
 					"%d\n", Op);
@@ -675,6 +1211,18 @@ static AieRC XAie_SocketIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_ERR;
 }
 
+static AieRC XAie_SocketIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		XAie_BackendOpCode Op, void *Arg)
 {
@@ -753,6 +1301,7 @@ const XAie_Backend SocketBackend =
 	.Ops.MaskPoll = XAie_SocketIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_SocketIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_SocketIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_SocketIO_BlockRead32,
 	.Ops.CmdWrite = XAie_SocketIO_CmdWrite,
 	.Ops.RunOp = XAie_SocketIO_RunOp,
 	.Ops.MemAllocate = XAie_SocketMemAllocate,
@@ -42,6 +42,8 @@
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_BAREMETAL
 #elif defined (__AIESOCKET__)
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_SOCKET
+#elif defined (__AIEREGFILE__)
+	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_REGFILE
 #else
 	#define __AIEDEBUG__
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_DEBUG
@@ -91,6 +93,7 @@ extern const XAie_Backend BaremetalBackend;
 extern const XAie_Backend DebugBackend;
 extern const XAie_Backend LinuxBackend;
 extern const XAie_Backend SocketBackend;
+extern const XAie_Backend RegFileBackend;
 
 static const XAie_Backend *IOBackend[XAIE_IO_BACKEND_MAX] =
 {
@@ -101,6 +104,7 @@ static const XAie_Backend *IOBackend[XAIE_IO_BACKEND_MAX] =
 	DEBUGBACKEND,
 	LINUXBACKEND,
 	SOCKETBACKEND,
+	&RegFileBackend,
 };
 
 /************************** Function Definitions *****************************/
@@ -54,6 +54,7 @@ typedef enum {
 	XAIE_BACKEND_OP_PARTITION_CLEAR_CONTEXT,
 	XAIE_BACKEND_OP_GET_RSC_STAT,
 	XAIE_BACKEND_OP_UPDATE_NPI_ADDR,
+	XAIE_BACKEND_OP_FLUSH_WRITES,
 } XAie_BackendOpCode;
 
 /*
@@ -144,6 +145,9 @@ typedef struct XAie_ShimDmaBdArgs {
  * BlockWrite32: IO operation to write a block of data at 32-bit granularity.
  * BlockSet32  : IO operation to initialize a chunk of aie address space with a
  *               a specified value at 32-bit granularity.
+ * BlockRead32 : IO operation to read a block of data at 32-bit granularity.
+ *               Optional, blocks are read one word at a time with Read32 if
+ *               NULL.
  * CmdWrite32  : This IO operation is required only in simulation mode. Other
  *               backends should have a no-op.
  * RunOp       : Run operation specified by the operation code
@@ -169,6 +173,7 @@ typedef struct XAie_BackendOps {
 			u32 TimeOutUs);
 	AieRC (*BlockWrite32)(void *IOInst, u64 RegOff, const u32 *Data, u32 Size);
 	AieRC (*BlockSet32)(void *IOInst, u64 RegOff, u32 Data, u32 Size);
+	AieRC (*BlockRead32)(void *IOInst, u64 RegOff, u32 *Data, u32 Size);
 	AieRC (*CmdWrite)(void *IOInst, u8 Col, u8 Row, u8 Command, u32 CmdWd0,
 			u32 CmdWd1, const char *CmdStr);
 	AieRC (*RunOp)(void *IOInst, XAie_DevInst *DevInst,
@@ -194,6 +199,7 @@ struct XAie_Backend {
 /************************** Function Prototypes  *****************************/
 AieRC XAie_IOInit(XAie_DevInst *DevInst);
 const XAie_Backend* _XAie_GetBackendPtr(XAie_BackendType Backend);
+void *_XAie_GetBackendIOInst(XAie_DevInst *DevInst);
 
 /*****************************************************************************/
 /**
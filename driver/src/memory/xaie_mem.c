@@ -318,14 +318,18 @@ AieRC XAie_DataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 		}
 	}
 
-	/* Aligned bytes */
-	for(u32 AlignedWord = 0; AlignedWord < RemBytes / 4;
-		AlignedWord++, BytePtr += 4, DmAddrRoundUp += 4) {
-		RC = XAie_Read32(DevInst, DmAddrRoundUp,
-				(u32 *)(CharDst + BytePtr));
+	/* Aligned bytes, read straight into the destination block */
+	if(RemBytes >= XAIE_MEM_WORD_ALIGN_SIZE) {
+		RC = XAie_BlockRead32(DevInst, DmAddrRoundUp,
+				(u32 *)(CharDst + BytePtr),
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE));
 		if(RC != XAIE_OK) {
 			return RC;
 		}
+		BytePtr += XAIE_MEM_WORD_ALIGN_SIZE *
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE);
+		DmAddrRoundUp += XAIE_MEM_WORD_ALIGN_SIZE *
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE);
 	}
 
 	/* Remaining bytes */
@@ -0,0 +1,468 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_mempool.c
+* @{
+*
+* This file contains the pool allocator of host memory shared with the AI
+* engine. Buffers are allocated from the backend with XAie_MemAllocate() in
+* size classes, four per power of two, and kept in the pool with their device
+* attachment when they are freed. Later allocations of the same class reuse
+* them without going to the backend. Idle buffers are released to the backend
+* when the pool holds more idle memory than its limit or when the pool is
+* trimmed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+#include <pthread.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_helper.h"
+#include "xaie_mempool.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_MEMPOOL_MIN_SHIFT		12U
+#define XAIE_MEMPOOL_MAX_SHIFT		48U
+#define XAIE_MEMPOOL_CLASSES_PER_SHIFT	4U
+#define XAIE_MEMPOOL_NUM_CLASSES	((XAIE_MEMPOOL_MAX_SHIFT - \
+			XAIE_MEMPOOL_MIN_SHIFT) * XAIE_MEMPOOL_CLASSES_PER_SHIFT)
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	XAie_MemInst **Idle;	/* Idle buffers of the class */
+	u32 NumIdle;
+	u32 MaxIdle;		/* Capacity of the idle array */
+} XAie_MemPoolClass;
+
+struct XAie_MemPool {
+	XAie_DevInst *DevInst;
+	XAie_MemCacheProp Cache;
+	u64 MaxIdleBytes;
+	XAie_MemPoolStats Stats;
+	XAie_MemPoolClass Classes[XAIE_MEMPOOL_NUM_CLASSES];
+#ifdef __linux__
+	pthread_mutex_t Lock;
+#endif
+};
+
+/************************** Function Definitions *****************************/
+static inline void _XAie_MemPoolLock(XAie_MemPool *Pool)
+{
+#ifdef __linux__
+	pthread_mutex_lock(&Pool->Lock);
+#else
+	(void)Pool;
+#endif
+}
+
+static inline void _XAie_MemPoolUnlock(XAie_MemPool *Pool)
+{
+#ifdef __linux__
+	pthread_mutex_unlock(&Pool->Lock);
+#else
+	(void)Pool;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the size class of a buffer size. Class sizes are the powers
+* of two from XAIE_MEMPOOL_MIN_SIZE and three sizes evenly spaced between
+* them, rounded up to a multiple of XAIE_MEMPOOL_MIN_SIZE.
+*
+* @param	Size: Size of the buffer in bytes.
+* @param	ClassSize: Pointer to return the size of the class.
+*
+* @return	Index of the class, XAIE_MEMPOOL_NUM_CLASSES if the size is too
+*		large to be pooled.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_MemPoolGetClass(u64 Size, u64 *ClassSize)
+{
+	u64 Step, Sub;
+	u32 Shift = XAIE_MEMPOOL_MIN_SHIFT;
+
+	if(Size <= XAIE_MEMPOOL_MIN_SIZE) {
+		*ClassSize = XAIE_MEMPOOL_MIN_SIZE;
+		return 0U;
+	}
+
+	/* Largest power of two strictly smaller than the size */
+	while((Shift < XAIE_MEMPOOL_MAX_SHIFT) &&
+			((1ULL << (Shift + 1U)) < Size)) {
+		Shift++;
+	}
+	if(Shift >= XAIE_MEMPOOL_MAX_SHIFT) {
+		return XAIE_MEMPOOL_NUM_CLASSES;
+	}
+
+	Step = (1ULL << Shift) / XAIE_MEMPOOL_CLASSES_PER_SHIFT;
+	if(Step < XAIE_MEMPOOL_MIN_SIZE) {
+		Step = XAIE_MEMPOOL_MIN_SIZE;
+	}
+
+	*ClassSize = (1ULL << Shift) +
+		((Size - (1ULL << Shift) + Step - 1U) / Step) * Step;
+	if(*ClassSize == (1ULL << (Shift + 1U))) {
+		Shift++;
+		Sub = 0U;
+	} else {
+		Sub = (*ClassSize - (1ULL << Shift)) /
+			((1ULL << Shift) / XAIE_MEMPOOL_CLASSES_PER_SHIFT);
+	}
+
+	if(Shift >= XAIE_MEMPOOL_MAX_SHIFT) {
+		return XAIE_MEMPOOL_NUM_CLASSES;
+	}
+
+	return (Shift - XAIE_MEMPOOL_MIN_SHIFT) *
+		XAIE_MEMPOOL_CLASSES_PER_SHIFT + (u32)Sub;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases idle buffers of a pool to the backend, from the largest
+* class down, until the idle memory of the pool is within a limit.
+*
+* @param	Pool: Memory pool.
+* @param	MaxIdleBytes: Idle memory to keep in the pool.
+*
+* @return	XAIE_OK on success, error code of the backend on failure.
+*
+* @note		Internal only. Pool lock must be held.
+*
+*******************************************************************************/
+static AieRC _XAie_MemPoolTrimLocked(XAie_MemPool *Pool, u64 MaxIdleBytes)
+{
+	AieRC RC = XAIE_OK;
+
+	for(u32 i = XAIE_MEMPOOL_NUM_CLASSES; i > 0U; i--) {
+		XAie_MemPoolClass *Class = &Pool->Classes[i - 1U];
+
+		while((Class->NumIdle > 0U) &&
+				(Pool->Stats.IdleBytes > MaxIdleBytes)) {
+			XAie_MemInst *MemInst = Class->Idle[--Class->NumIdle];
+
+			Pool->Stats.IdleBytes -= MemInst->Size;
+			Pool->Stats.NumIdle--;
+			Pool->Stats.NumReleases++;
+			if(XAie_MemFree(MemInst) != XAIE_OK) {
+				RC = XAIE_ERR;
+			}
+		}
+
+		if(Class->NumIdle == 0U) {
+			free(Class->Idle);
+			Class->Idle = NULL;
+			Class->MaxIdle = 0U;
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a pool of host memory buffers shared with the AI engine.
+*
+* @param	DevInst: Device Instance
+* @param	Cache: Cache property of the buffers of the pool.
+* @param	MaxIdleBytes: Maximum size of the idle buffers kept in the
+*		pool. Buffers freed beyond this limit are released to the
+*		backend. XAIE_MEMPOOL_NO_IDLE_LIMIT keeps all the buffers.
+*
+* @return	Pointer to the memory pool, NULL on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+XAie_MemPool* XAie_MemPoolCreate(XAie_DevInst *DevInst,
+		XAie_MemCacheProp Cache, u64 MaxIdleBytes)
+{
+	XAie_MemPool *Pool;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return NULL;
+	}
+
+	if(Cache > XAIE_MEM_NONCACHEABLE) {
+		XAIE_ERROR("Invalid cache property\n");
+		return NULL;
+	}
+
+	Pool = (XAie_MemPool *)calloc(1U, sizeof(*Pool));
+	if(Pool == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return NULL;
+	}
+
+#ifdef __linux__
+	if(pthread_mutex_init(&Pool->Lock, NULL) != 0) {
+		XAIE_ERROR("Failed to initialize memory pool lock\n");
+		free(Pool);
+		return NULL;
+	}
+#endif
+
+	Pool->DevInst = DevInst;
+	Pool->Cache = Cache;
+	Pool->MaxIdleBytes = MaxIdleBytes;
+
+	return Pool;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API destroys a memory pool and releases its idle buffers to the
+* backend.
+*
+* @param	Pool: Memory pool.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Buffers of the pool which are still in use are not released.
+*		They shall be freed with XAie_MemFree().
+*
+*******************************************************************************/
+AieRC XAie_MemPoolDestroy(XAie_MemPool *Pool)
+{
+	AieRC RC;
+
+	if(Pool == XAIE_NULL) {
+		XAIE_ERROR("Invalid memory pool\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Pool->Stats.InUseBytes != 0U) {
+		XAIE_WARN("Destroying memory pool with 0x%lx bytes in use\n",
+				Pool->Stats.InUseBytes);
+	}
+
+	RC = _XAie_MemPoolTrimLocked(Pool, 0U);
+#ifdef __linux__
+	pthread_mutex_destroy(&Pool->Lock);
+#endif
+	free(Pool);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates a buffer from a memory pool. An idle buffer of the size
+* class of the request is reused if there is one, otherwise a buffer of the
+* class size is allocated from the backend.
+*
+* @param	Pool: Memory pool.
+* @param	Size: Size of the buffer in bytes.
+*
+* @return	Pointer to the memory instance, NULL on failure.
+*
+* @note		The size of the returned memory instance is the size of the
+*		class, which may be larger than the requested size. If the
+*		backend allocation fails, the idle buffers of the pool are
+*		released and the allocation is retried once.
+*
+*******************************************************************************/
+XAie_MemInst* XAie_MemPoolAlloc(XAie_MemPool *Pool, u64 Size)
+{
+	XAie_MemPoolClass *Class;
+	XAie_MemInst *MemInst = NULL;
+	u64 ClassSize;
+	u32 Idx;
+
+	if((Pool == XAIE_NULL) || (Size == 0U)) {
+		XAIE_ERROR("Invalid memory pool or size\n");
+		return NULL;
+	}
+
+	Idx = _XAie_MemPoolGetClass(Size, &ClassSize);
+	if(Idx >= XAIE_MEMPOOL_NUM_CLASSES) {
+		XAIE_ERROR("Size 0x%lx is too large for memory pool\n", Size);
+		return NULL;
+	}
+
+	Class = &Pool->Classes[Idx];
+	_XAie_MemPoolLock(Pool);
+	if(Class->NumIdle > 0U) {
+		MemInst = Class->Idle[--Class->NumIdle];
+		Pool->Stats.IdleBytes -= ClassSize;
+		Pool->Stats.NumIdle--;
+		Pool->Stats.NumHits++;
+		Pool->Stats.InUseBytes += ClassSize;
+		_XAie_MemPoolUnlock(Pool);
+		return MemInst;
+	}
+	Pool->Stats.NumMisses++;
+	_XAie_MemPoolUnlock(Pool);
+
+	MemInst = XAie_MemAllocate(Pool->DevInst, ClassSize, Pool->Cache);
+	if(MemInst == NULL) {
+		_XAie_MemPoolLock(Pool);
+		_XAie_MemPoolTrimLocked(Pool, 0U);
+		_XAie_MemPoolUnlock(Pool);
+		MemInst = XAie_MemAllocate(Pool->DevInst, ClassSize,
+				Pool->Cache);
+		if(MemInst == NULL) {
+			XAIE_ERROR("Failed to allocate 0x%lx bytes for memory "
+					"pool\n", ClassSize);
+			return NULL;
+		}
+	}
+
+	_XAie_MemPoolLock(Pool);
+	Pool->Stats.InUseBytes += MemInst->Size;
+	_XAie_MemPoolUnlock(Pool);
+
+	return MemInst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees a buffer allocated from a memory pool. The buffer is kept in
+* the pool for later allocations unless the idle memory of the pool would
+* exceed its limit, in which case it is released to the backend.
+*
+* @param	Pool: Memory pool.
+* @param	MemInst: Memory instance allocated with XAie_MemPoolAlloc().
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_MemPoolFree(XAie_MemPool *Pool, XAie_MemInst *MemInst)
+{
+	XAie_MemPoolClass *Class;
+	u64 ClassSize;
+	u32 Idx;
+
+	if((Pool == XAIE_NULL) || (MemInst == XAIE_NULL) ||
+			(MemInst->DevInst != Pool->DevInst)) {
+		XAIE_ERROR("Invalid memory pool or memory instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Idx = _XAie_MemPoolGetClass(MemInst->Size, &ClassSize);
+
+	_XAie_MemPoolLock(Pool);
+	Pool->Stats.InUseBytes -= MemInst->Size;
+
+	/* Buffers the backend did not allocate at a class size are dropped */
+	if((Idx >= XAIE_MEMPOOL_NUM_CLASSES) || (ClassSize != MemInst->Size) ||
+			(Pool->Stats.IdleBytes + ClassSize >
+			 Pool->MaxIdleBytes)) {
+		Pool->Stats.NumReleases++;
+		_XAie_MemPoolUnlock(Pool);
+		return XAie_MemFree(MemInst);
+	}
+
+	Class = &Pool->Classes[Idx];
+	if(Class->NumIdle == Class->MaxIdle) {
+		u32 MaxIdle = (Class->MaxIdle == 0U) ? 4U : Class->MaxIdle * 2U;
+		XAie_MemInst **Idle;
+
+		Idle = (XAie_MemInst **)realloc(Class->Idle,
+				MaxIdle * sizeof(*Idle));
+		if(Idle == NULL) {
+			Pool->Stats.NumReleases++;
+			_XAie_MemPoolUnlock(Pool);
+			return XAie_MemFree(MemInst);
+		}
+		Class->Idle = Idle;
+		Class->MaxIdle = MaxIdle;
+	}
+
+	Class->Idle[Class->NumIdle++] = MemInst;
+	Pool->Stats.IdleBytes += ClassSize;
+	Pool->Stats.NumIdle++;
+	_XAie_MemPoolUnlock(Pool);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases idle buffers of a memory pool to the backend, largest
+* buffers first, until the idle memory of the pool is within a limit.
+*
+* @param	Pool: Memory pool.
+* @param	MaxIdleBytes: Idle memory to keep in the pool, 0 to release all
+*		the idle buffers.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The idle limit given at the creation of the pool is unchanged.
+*
+*******************************************************************************/
+AieRC XAie_MemPoolTrim(XAie_MemPool *Pool, u64 MaxIdleBytes)
+{
+	AieRC RC;
+
+	if(Pool == XAIE_NULL) {
+		XAIE_ERROR("Invalid memory pool\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_MemPoolLock(Pool);
+	RC = _XAie_MemPoolTrimLocked(Pool, MaxIdleBytes);
+	_XAie_MemPoolUnlock(Pool);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the statistics of a memory pool.
+*
+* @param	Pool: Memory pool.
+* @param	Stats: Pointer to return the statistics.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_MemPoolGetStats(XAie_MemPool *Pool, XAie_MemPoolStats *Stats)
+{
+	if((Pool == XAIE_NULL) || (Stats == XAIE_NULL)) {
+		XAIE_ERROR("Invalid memory pool or statistics pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_MemPoolLock(Pool);
+	*Stats = Pool->Stats;
+	_XAie_MemPoolUnlock(Pool);
+
+	return XAIE_OK;
+}
+
+/** @} */
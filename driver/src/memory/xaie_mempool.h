@@ -0,0 +1,57 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_mempool.h
+* @{
+*
+* Header file for the pool allocator of host memory shared with the AI engine.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date        Changes
+* ----- ------  --------    ---------------------------------------------------
+* 1.0   agent   10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_MEMPOOL_H
+#define XAIE_MEMPOOL_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_MEMPOOL_MIN_SIZE		0x1000U	/* Size of the smallest class */
+#define XAIE_MEMPOOL_NO_IDLE_LIMIT	(~0ULL)
+
+/****************************** Type Definitions *****************************/
+typedef struct XAie_MemPool XAie_MemPool;
+
+/* Statistics of a memory pool */
+typedef struct {
+	u64 NumHits;		/* Allocations served from idle buffers */
+	u64 NumMisses;		/* Allocations served by the backend */
+	u64 NumReleases;	/* Buffers given back to the backend */
+	u64 NumIdle;		/* Buffers kept in the pool */
+	u64 IdleBytes;		/* Bytes kept in the pool */
+	u64 InUseBytes;		/* Bytes handed out and not freed yet */
+} XAie_MemPoolStats;
+
+/************************** Function Prototypes  *****************************/
+XAie_MemPool* XAie_MemPoolCreate(XAie_DevInst *DevInst,
+		XAie_MemCacheProp Cache, u64 MaxIdleBytes);
+AieRC XAie_MemPoolDestroy(XAie_MemPool *Pool);
+XAie_MemInst* XAie_MemPoolAlloc(XAie_MemPool *Pool, u64 Size);
+AieRC XAie_MemPoolFree(XAie_MemPool *Pool, XAie_MemInst *MemInst);
+AieRC XAie_MemPoolTrim(XAie_MemPool *Pool, u64 MaxIdleBytes);
+AieRC XAie_MemPoolGetStats(XAie_MemPool *Pool, XAie_MemPoolStats *Stats);
+
+#endif		/* end of protection macro */
+
+/** @} */
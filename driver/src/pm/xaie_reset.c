@@ -18,6 +18,7 @@
 #include "xaie_helper.h"
 #include "xaie_npi.h"
 #include "xaie_reset.h"
+#include "xaie_shadow.h"
 #include "xaiegbl.h"
 
 #ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
@@ -232,6 +233,9 @@ AieRC XAie_ResetPartition(XAie_DevInst *DevInst)
 		return XAIE_INVALID_ARGS;
 	}
 
+	/* Reset sequence does not write any register held by the cache */
+	_XAie_ShadowInvalidate(DevInst);
+
 	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
 	if(RC != XAIE_OK) {
 		return RC;
@@ -31,6 +31,7 @@
 #include "xaie_rsc.h"
 #include "xaie_rsc_internal.h"
 #include "xaie_helper.h"
+#include "xaie_sync.h"
 
 #ifdef XAIE_FEATURE_RSC_ENABLE
 /*****************************************************************************/
@@ -692,6 +693,10 @@ AieRC _XAie_RscMgr_RequestRsc(XAie_DevInst *DevInst, u32 NumReq,
 {
 	AieRC RC;
 	u32 UserRscIndex = 0U;
+	u32 Token;
+
+	/* Requests of a call are granted, or rolled back, as a whole */
+	Token = _XAie_SyncAcquireDevice(DevInst);
 
 	for(u32 i = 0U; i < NumReq; i++) {
 		XAie_BackendTilesRsc TilesRsc = {0};
@@ -719,6 +724,7 @@ AieRC _XAie_RscMgr_RequestRsc(XAie_DevInst *DevInst, u32 NumReq,
 			/* Clear resource marking for all previous requests */
 			_XAie_RscMgr_FreeRscs(DevInst, UserRscIndex, Rscs,
 					RscType);
+			_XAie_SyncRelease(DevInst, Token);
 			XAIE_WARN("Unable to request resources. RscType: %d\n",
 					RscType);
 			return XAIE_INVALID_ARGS;
@@ -731,6 +737,8 @@ AieRC _XAie_RscMgr_RequestRsc(XAie_DevInst *DevInst, u32 NumReq,
 		}
 	}
 
+	_XAie_SyncRelease(DevInst, Token);
+
 	return XAIE_OK;
 }
 
@@ -740,6 +748,10 @@ AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
 {
 	AieRC RC;
 	u32 UserRscIndex = 0U;
+	u32 Token;
+
+	/* Requests of a call are granted, or rolled back, as a whole */
+	Token = _XAie_SyncAcquireDevice(DevInst);
 
 	for(u32 i = 0U; i < NumReq; i++) {
 		XAie_BackendTilesRsc TilesRsc = {0};
@@ -769,6 +781,7 @@ AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
 			/* Clear resource marking for all previous requests */
 			_XAie_RscMgr_FreeRscs(DevInst, UserRscIndex, Rscs,
 					RscType);
+			_XAie_SyncRelease(DevInst, Token);
 			XAIE_WARN("Unable to request resources. RscType: %d\n",
 					RscType);
 			return XAIE_INVALID_ARGS;
@@ -781,6 +794,8 @@ AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
 		}
 	}
 
+	_XAie_SyncRelease(DevInst, Token);
+
 	return XAIE_OK;
 }
 
@@ -805,6 +820,9 @@ AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
 AieRC _XAie_RscMgr_FreeRscs(XAie_DevInst *DevInst, u32 RscNum,
 		XAie_UserRsc *Rscs, XAie_RscType RscType)
 {
+	u32 Token;
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
 	for(u32 i =0U; i < RscNum; i++) {
 		XAie_BackendTilesRsc TilesRsc = {0};
 		XAie_BitmapOffsets Offsets;
@@ -830,6 +848,8 @@ AieRC _XAie_RscMgr_FreeRscs(XAie_DevInst *DevInst, u32 RscNum,
 				(void *)&TilesRsc);
 	}
 
+	_XAie_SyncRelease(DevInst, Token);
+
 	return XAIE_OK;
 }
 
@@ -854,6 +874,9 @@ AieRC _XAie_RscMgr_FreeRscs(XAie_DevInst *DevInst, u32 RscNum,
 AieRC _XAie_RscMgr_ReleaseRscs(XAie_DevInst *DevInst, u32 RscNum,
 		XAie_UserRsc *Rscs, XAie_RscType RscType)
 {
+	u32 Token;
+
+	Token = _XAie_SyncAcquireDevice(DevInst);
 	for(u32 i =0U; i < RscNum; i++) {
 		XAie_BackendTilesRsc TilesRsc = {0};
 		XAie_BitmapOffsets Offsets;
@@ -880,6 +903,8 @@ AieRC _XAie_RscMgr_ReleaseRscs(XAie_DevInst *DevInst, u32 RscNum,
 				(void *)&TilesRsc);
 	}
 
+	_XAie_SyncRelease(DevInst, Token);
+
 	return XAIE_OK;
 }
 
@@ -908,6 +933,10 @@ AieRC _XAie_RscMgr_RequestAllocatedRsc(XAie_DevInst *DevInst, u32 NumReq,
 {
 	AieRC RC;
 	u32 UserRscIndex = 0U;
+	u32 Token;
+
+	/* Requests of a call are granted, or rolled back, as a whole */
+	Token = _XAie_SyncAcquireDevice(DevInst);
 
 	for(u32 i =0U; i < NumReq; i++) {
 		XAie_BackendTilesRsc TilesRsc = {0};
@@ -935,6 +964,7 @@ AieRC _XAie_RscMgr_RequestAllocatedRsc(XAie_DevInst *DevInst, u32 NumReq,
 			/* Clear resource marking for all previous requests */
 			_XAie_RscMgr_FreeRscs(DevInst, UserRscIndex, Rscs,
 					RscType);
+			_XAie_SyncRelease(DevInst, Token);
 			XAIE_WARN("Unable to request resources. RscType: %d\n",
 					RscType);
 			return XAIE_INVALID_ARGS;
@@ -943,6 +973,8 @@ AieRC _XAie_RscMgr_RequestAllocatedRsc(XAie_DevInst *DevInst, u32 NumReq,
 		UserRscIndex++;
 	}
 
+	_XAie_SyncRelease(DevInst, Token);
+
 	return XAIE_OK;
 }
 
@@ -1101,7 +1133,7 @@ static XAie_ModuleType _XAie_GetModTypefromModIndex(u8 TileType, u8 ModIndex)
 
 /*****************************************************************************/
 /**
-* This API is used to dump the total allocated resources to a file.
+* This API dumps the total allocated resources to a file.
 *
 * @param	DevInst: Device Instance
 * @param	File: Path of the file which will contain the information of
@@ -1109,8 +1141,10 @@ static XAie_ModuleType _XAie_GetModTypefromModIndex(u8 TileType, u8 ModIndex)
 *
 * @return	XAIE_OK on success and error code on failure.
 *
+* @note		Internal only.
+*
 *******************************************************************************/
-AieRC XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst, const char *File)
+static AieRC _XAie_SaveAllocatedRscs(XAie_DevInst *DevInst, const char *File)
 {
 	FILE *F;
 	size_t Ret;
@@ -1247,6 +1281,36 @@ AieRC XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst, const char *File)
 
 }
 
+/*****************************************************************************/
+/**
+* This API is used to dump the total allocated resources to a file.
+*
+* @param	DevInst: Device Instance
+* @param	File: Path of the file which will contain the information of
+*		      all the allocated resources.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+*******************************************************************************/
+AieRC XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst, const char *File)
+{
+	AieRC RC;
+	u32 Token;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Bitmaps must not change while they are dumped */
+	Token = _XAie_SyncAcquireDevice(DevInst);
+	RC = _XAie_SaveAllocatedRscs(DevInst, File);
+	_XAie_SyncRelease(DevInst, Token);
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 * This API is used to apply resource meta data to resource static bitmaps
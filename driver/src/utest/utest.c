@@ -48,8 +48,391 @@ typedef struct {
     u32 timeout;
 }  __attribute__((packed, aligned(4))) dpu_op_2;
 
+/*
+ * Example host handler for the register poll op.
+ */
+static AieRC dpu_op_2_handler(XAie_DevInst *DevInst, u8 OpNumber, void *Args,
+        u32 Size, void *Priv) {
+    dpu_op_2 *dpu_op2 = (dpu_op_2 *)Args;
+
+    (void)DevInst;
+    (void)Priv;
+
+    if(Size != sizeof(dpu_op_2)) {
+        return XAIE_INVALID_ARGS;
+    }
+
+    printf("Custom op %d: poll 0x%x, timeout %d\n", OpNumber,
+            dpu_op2->addr, dpu_op2->timeout);
+
+    return XAIE_OK;
+}
+
+
+/*
+ * Register file device used by the backend tests: AIE-ML array with the shim
+ * at row 0, a memory tile at row 1 and AIE tiles from row 2.
+ */
+#define UTEST_RF_COL_SHIFT      25U
+#define UTEST_RF_ROW_SHIFT      20U
+#define UTEST_RF_TILE(Col, Row) (((u64)(Col) << UTEST_RF_COL_SHIFT) | \
+        ((u64)(Row) << UTEST_RF_ROW_SHIFT))
+
+#define UTEST_MEMTILE_MM2S_0_START_QUEUE  0xA0634U
+#define UTEST_MEMTILE_MM2S_0_STATUS       0xA0680U
+#define UTEST_MEMTILE_MM2S_1_STATUS       0xA0684U
+#define UTEST_DMA_STATUS_TASK_QUEUE_LSB   20U
+
+#define UTEST_CHECK(Cond) \
+    do { \
+        if(!(Cond)) { \
+            printf("UNIT TEST FAIL %s:%d: %s\n", __FILE__, __LINE__, \
+                    #Cond); \
+            return 1; \
+        } \
+    } while(0)
+
+static XAie_SetupConfig(RegFileConfig, XAIE_DEV_GEN_AIEML, 0x20000000000ULL,
+        UTEST_RF_COL_SHIFT, UTEST_RF_ROW_SHIFT, 5U, 6U, 0U, 1U, 1U, 2U, 4U);
+
+static int regfile_init(XAie_DevInst *DevInst) {
+    memset(DevInst, 0, sizeof(*DevInst));
+    UTEST_CHECK(XAie_CfgInitialize(DevInst, &RegFileConfig) == XAIE_OK);
+    UTEST_CHECK(XAie_SetIOBackend(DevInst, XAIE_IO_BACKEND_REGFILE) ==
+            XAIE_OK);
+
+    return 0;
+}
+
+static int regfile_compare(XAie_DevInst *DevA, XAie_DevInst *DevB,
+        u64 RegOff, u32 NumWords) {
+    for(u32 i = 0U; i < NumWords; i++) {
+        u32 A, B;
+
+        UTEST_CHECK(XAie_Read32(DevA, RegOff + 4U * i, &A) == XAIE_OK);
+        UTEST_CHECK(XAie_Read32(DevB, RegOff + 4U * i, &B) == XAIE_OK);
+        UTEST_CHECK(A == B);
+    }
+
+    return 0;
+}
+
+/*
+ * Records writes of every kind, replays them natively and through an
+ * export/import round trip, then patches the imported instance.
+ */
+static int test_txn_round_trip(void) {
+    XAie_DevInst DevA, DevB;
+    u64 Tile = UTEST_RF_TILE(1U, 2U);
+    u32 Data[4] = {1U, 2U, 3U, 4U};
+    u32 Slot, Value;
+
+    if(regfile_init(&DevA) != 0 || regfile_init(&DevB) != 0) {
+        return 1;
+    }
+
+    UTEST_CHECK(XAie_StartTransaction(&DevA,
+                XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) == XAIE_OK);
+    XAie_Write32(&DevA, Tile + 0x1D000U, 0x11U);
+    XAie_BlockWrite32(&DevA, Tile + 0x1D100U, Data, 4U);
+    XAie_MaskWrite32(&DevA, Tile + 0x1D200U, 0xFF00U, 0x1200U);
+    XAie_BlockSet32(&DevA, Tile + 0x1D300U, 0xABU, 64U);
+
+    u8 *TxnPtr = XAie_ExportSerializedTransaction(&DevA, 0U, 0U);
+    UTEST_CHECK(TxnPtr != NULL);
+    XAie_TxnHeader *Header = (XAie_TxnHeader *)TxnPtr;
+    UTEST_CHECK(Header->NumOps == 4U && Header->Minor == 2U);
+    UTEST_CHECK(Header->TxnSize < 64U * sizeof(u32));
+    UTEST_CHECK(XAie_SubmitTransaction(&DevA, NULL) == XAIE_OK);
+
+    UTEST_CHECK(XAie_ImportSerializedTransaction(&DevB, TxnPtr,
+                Header->TxnSize - 1U) == NULL);
+    XAie_TxnInst *TxnInst = XAie_ImportSerializedTransaction(&DevB, TxnPtr,
+            Header->TxnSize);
+    UTEST_CHECK(TxnInst != NULL);
+    UTEST_CHECK(XAie_SubmitTransaction(&DevB, TxnInst) == XAIE_OK);
+    if(regfile_compare(&DevA, &DevB, Tile + 0x1D000U, 0x400U / 4U) != 0) {
+        return 1;
+    }
+    UTEST_CHECK(XAie_Read32(&DevB, Tile + 0x1D3FCU, &Value) == XAIE_OK &&
+            Value == 0xABU);
+
+    /* Patch an address into the first write, bits [31:2] */
+    UTEST_CHECK(XAie_TxnAddPatchPoint(TxnInst, Tile + 0x1D000U, 0xFFFFFFFCU,
+                2U, &Slot) == XAIE_OK);
+    UTEST_CHECK(XAie_TxnPatch(TxnInst, Slot, 0x123456789A0ULL) == XAIE_OK);
+    UTEST_CHECK(XAie_SubmitTransaction(&DevB, TxnInst) == XAIE_OK);
+    UTEST_CHECK(XAie_Read32(&DevB, Tile + 0x1D000U, &Value) == XAIE_OK &&
+            Value == 0x456789A1U);
+
+    UTEST_CHECK(XAie_FreeTransactionInstance(TxnInst) == XAIE_OK);
+    XAie_FreeSerializedTransaction(TxnPtr);
+    XAie_Finish(&DevA);
+    XAie_Finish(&DevB);
+
+    return 0;
+}
+
+static void record_writes(XAie_DevInst *DevInst, u64 Tile) {
+    u32 Data[3] = {10U, 11U, 12U};
+
+    for(u32 i = 0U; i < 8U; i++) {
+        XAie_Write32(DevInst, Tile + 0x1D000U + 4U * i, i);
+    }
+    XAie_BlockWrite32(DevInst, Tile + 0x1D020U, Data, 3U);
+    XAie_Write32(DevInst, Tile + 0x1D008U, 0x55U);
+    XAie_MaskWrite32(DevInst, Tile + 0x1D100U, 0x1U, 0x1U);
+    XAie_MaskWrite32(DevInst, Tile + 0x1D100U, 0x6U, 0x4U);
+    XAie_MaskWrite32(DevInst, Tile + 0x1D100U, 0x1U, 0x0U);
+    XAie_Write32(DevInst, Tile + 0x1D104U, 0x77U);
+}
+
+/*
+ * A coalesced transaction writes the same registers as an uncoalesced one.
+ */
+static int test_txn_coalescing(void) {
+    XAie_DevInst DevA, DevB;
+    u64 Tile = UTEST_RF_TILE(2U, 3U);
+
+    if(regfile_init(&DevA) != 0 || regfile_init(&DevB) != 0) {
+        return 1;
+    }
+
+    UTEST_CHECK(XAie_StartTransaction(&DevA,
+                XAIE_TRANSACTION_ENABLE_COALESCING) == XAIE_OK);
+    UTEST_CHECK(XAie_StartTransaction(&DevB,
+                XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) == XAIE_OK);
+    record_writes(&DevA, Tile);
+    record_writes(&DevB, Tile);
+
+    XAie_TxnInst *TxnA = XAie_ExportTransactionInstance(&DevA);
+    XAie_TxnInst *TxnB = XAie_ExportTransactionInstance(&DevB);
+    UTEST_CHECK(TxnA != NULL && TxnB != NULL);
+    UTEST_CHECK(TxnA->NumCmds < TxnB->NumCmds);
+    UTEST_CHECK(XAie_FreeTransactionInstance(TxnA) == XAIE_OK);
+    UTEST_CHECK(XAie_FreeTransactionInstance(TxnB) == XAIE_OK);
+
+    UTEST_CHECK(XAie_SubmitTransaction(&DevA, NULL) == XAIE_OK);
+    UTEST_CHECK(XAie_SubmitTransaction(&DevB, NULL) == XAIE_OK);
+    if(regfile_compare(&DevA, &DevB, Tile + 0x1D000U, 0x110U / 4U) != 0) {
+        return 1;
+    }
+
+    XAie_Finish(&DevA);
+    XAie_Finish(&DevB);
+
+    return 0;
+}
+
+static void count_writes(void *Priv, u64 RegOff, u32 *Value, u8 IsWrite) {
+    (void)RegOff;
+    (void)Value;
+
+    if(IsWrite != 0U) {
+        (*(u32 *)Priv)++;
+    }
+}
+
+/*
+ * The shadow cache drops rewrites of cached configuration registers until it
+ * is invalidated.
+ */
+static int test_shadow_cache(void) {
+    XAie_DevInst DevInst;
+    u64 Tile = UTEST_RF_TILE(1U, 2U);
+    u32 Writes = 0U;
+
+    if(regfile_init(&DevInst) != 0) {
+        return 1;
+    }
+    UTEST_CHECK(XAie_RegFileSetHook(&DevInst, count_writes, &Writes) ==
+            XAIE_OK);
+    UTEST_CHECK(XAie_EnableShadowCache(&DevInst) == XAIE_OK);
+
+    /* Stream switch master configuration is cached */
+    XAie_Write32(&DevInst, Tile + 0x3F000U, 0x80000000U);
+    XAie_Write32(&DevInst, Tile + 0x3F000U, 0x80000000U);
+    UTEST_CHECK(Writes == 1U);
+    XAie_Write32(&DevInst, Tile + 0x3F000U, 0x80000001U);
+    UTEST_CHECK(Writes == 2U);
+
+    /* Data memory is not */
+    XAie_Write32(&DevInst, Tile + 0x100U, 1U);
+    XAie_Write32(&DevInst, Tile + 0x100U, 1U);
+    UTEST_CHECK(Writes == 4U);
+
+    UTEST_CHECK(XAie_InvalidateShadowCache(&DevInst) == XAIE_OK);
+    XAie_Write32(&DevInst, Tile + 0x3F000U, 0x80000001U);
+    UTEST_CHECK(Writes == 5U);
+    XAie_Write32(&DevInst, Tile + 0x3F000U, 0x80000001U);
+    UTEST_CHECK(Writes == 5U);
+
+    UTEST_CHECK(XAie_DisableShadowCache(&DevInst) == XAIE_OK);
+    XAie_Write32(&DevInst, Tile + 0x3F000U, 0x80000001U);
+    UTEST_CHECK(Writes == 6U);
+
+    XAie_Finish(&DevInst);
+
+    return 0;
+}
+
+/*
+ * XAie_DmaWriteBds() programs the same registers as one XAie_DmaWriteBd()
+ * call per BD.
+ */
+static int test_dma_write_bds(void) {
+    static XAie_DmaDesc Descs[48U];
+    static u32 Snapshot[48U * 8U];
+    XAie_DevInst DevInst;
+    struct {
+        XAie_LocType Loc;
+        u32 BdBase;
+        u8 NumBds;
+    } Tiles[3] = {
+        { XAie_TileLoc(1, 3), 0x1D000U, 16U },
+        { XAie_TileLoc(1, 1), 0xA0000U, 48U },
+        { XAie_TileLoc(2, 0), 0x1D000U, 16U },
+    };
+
+    if(regfile_init(&DevInst) != 0) {
+        return 1;
+    }
+
+    for(u32 t = 0U; t < 3U; t++) {
+        XAie_LocType Loc = Tiles[t].Loc;
+        u64 Base = UTEST_RF_TILE(Loc.Col, Loc.Row) + Tiles[t].BdBase;
+        u32 NumWords = Tiles[t].NumBds * 8U;
+        u32 Value;
+
+        for(u8 i = 0U; i < Tiles[t].NumBds; i++) {
+            UTEST_CHECK(XAie_DmaDescInit(&DevInst, &Descs[i], Loc) ==
+                    XAIE_OK);
+            UTEST_CHECK(XAie_DmaSetAddrLen(&Descs[i], 0x1000U + 64U * i,
+                        64U + 4U * i) == XAIE_OK);
+            UTEST_CHECK(XAie_DmaSetNextBd(&Descs[i],
+                        (i + 1U) % Tiles[t].NumBds, XAIE_ENABLE) == XAIE_OK);
+            UTEST_CHECK(XAie_DmaEnableBd(&Descs[i]) == XAIE_OK);
+        }
+
+        UTEST_CHECK(XAie_DmaWriteBds(&DevInst, Loc, 0U, Descs,
+                    Tiles[t].NumBds) == XAIE_OK);
+        for(u32 i = 0U; i < NumWords; i++) {
+            XAie_Read32(&DevInst, Base + 4U * i, &Snapshot[i]);
+            XAie_Write32(&DevInst, Base + 4U * i, 0U);
+        }
+
+        for(u8 i = 0U; i < Tiles[t].NumBds; i++) {
+            UTEST_CHECK(XAie_DmaWriteBd(&DevInst, &Descs[i], Loc, i) ==
+                    XAIE_OK);
+        }
+        for(u32 i = 0U; i < NumWords; i++) {
+            XAie_Read32(&DevInst, Base + 4U * i, &Value);
+            UTEST_CHECK(Value == Snapshot[i]);
+        }
+
+        /* The run shall fit in the tile */
+        UTEST_CHECK(XAie_DmaWriteBds(&DevInst, Loc, 1U, Descs,
+                    Tiles[t].NumBds) == XAIE_INVALID_BD_NUM);
+    }
+
+    XAie_Finish(&DevInst);
+
+    return 0;
+}
+
+static void set_task_queue(XAie_DevInst *DevInst, u32 StatusOff, u32 Size) {
+    XAie_Write32(DevInst, UTEST_RF_TILE(1U, 1U) + StatusOff,
+            Size << UTEST_DMA_STATUS_TASK_QUEUE_LSB);
+}
+
+static int check_next_bd(XAie_DevInst *DevInst, u8 BdNum, u8 UseNxtBd,
+        u8 NxtBd) {
+    XAie_LocType Loc = XAie_TileLoc(1, 1);
+    XAie_DmaDesc Desc;
+
+    UTEST_CHECK(XAie_DmaDescInit(DevInst, &Desc, Loc) == XAIE_OK);
+    UTEST_CHECK(XAie_DmaReadBd(DevInst, &Desc, Loc, BdNum) == XAIE_OK);
+    UTEST_CHECK(Desc.BdEnDesc.UseNxtBd == UseNxtBd);
+    UTEST_CHECK(UseNxtBd == XAIE_DISABLE || Desc.BdEnDesc.NxtBd == NxtBd);
+
+    return 0;
+}
+
+/*
+ * BD rings chain the BDs of a submission, recycle them as the channel task
+ * queue drains, and track tasks through their completion handles.
+ */
+static int test_dma_bd_ring(void) {
+    XAie_DevInst DevInst;
+    XAie_LocType Loc = XAie_TileLoc(1, 1);
+    XAie_DmaDesc Descs[3];
+    XAie_DmaTask Task;
+    u8 FirstBd, NumFree, Done;
+    u32 Value;
+
+    if(regfile_init(&DevInst) != 0) {
+        return 1;
+    }
+
+    XAie_DmaBdRing *Ring = XAie_DmaBdRingCreate(&DevInst, Loc, 0U, DMA_MM2S,
+            4U);
+    UTEST_CHECK(Ring != NULL);
+    for(u8 i = 0U; i < 3U; i++) {
+        UTEST_CHECK(XAie_DmaDescInit(&DevInst, &Descs[i], Loc) == XAIE_OK);
+        UTEST_CHECK(XAie_DmaSetAddrLen(&Descs[i], 0x1000U * (i + 1U), 64U) ==
+                XAIE_OK);
+        UTEST_CHECK(XAie_DmaEnableBd(&Descs[i]) == XAIE_OK);
+    }
+
+    UTEST_CHECK(XAie_DmaBdRingSubmit(Ring, Descs, 2U, XAIE_DISABLE,
+                &FirstBd) == XAIE_OK && FirstBd == 0U);
+    if(check_next_bd(&DevInst, 0U, XAIE_ENABLE, 1U) != 0 ||
+            check_next_bd(&DevInst, 1U, XAIE_DISABLE, 0U) != 0) {
+        return 1;
+    }
+
+    /* First task still queued: its BDs are not recycled */
+    set_task_queue(&DevInst, UTEST_MEMTILE_MM2S_0_STATUS, 1U);
+    UTEST_CHECK(XAie_DmaBdRingSubmit(Ring, Descs, 2U, XAIE_DISABLE,
+                &FirstBd) == XAIE_OK && FirstBd == 2U);
+    XAie_Read32(&DevInst, UTEST_RF_TILE(1U, 1U) +
+            UTEST_MEMTILE_MM2S_0_START_QUEUE, &Value);
+    UTEST_CHECK((Value & 0x3FU) == 2U);
+    UTEST_CHECK(XAie_DmaBdRingGetNumFree(Ring, &NumFree) == XAIE_OK &&
+            NumFree == 2U);
+    UTEST_CHECK(XAie_DmaBdRingSubmit(Ring, Descs, 3U, XAIE_DISABLE,
+                &FirstBd) == XAIE_ERR);
+
+    /* Queue drained: the ring wraps around to BD 0 */
+    set_task_queue(&DevInst, UTEST_MEMTILE_MM2S_0_STATUS, 0U);
+    UTEST_CHECK(XAie_DmaBdRingSubmit(Ring, Descs, 3U, XAIE_DISABLE,
+                &FirstBd) == XAIE_OK && FirstBd == 0U);
+    if(check_next_bd(&DevInst, 0U, XAIE_ENABLE, 1U) != 0 ||
+            check_next_bd(&DevInst, 1U, XAIE_ENABLE, 2U) != 0 ||
+            check_next_bd(&DevInst, 2U, XAIE_DISABLE, 0U) != 0) {
+        return 1;
+    }
+    UTEST_CHECK(XAie_DmaBdRingDestroy(Ring) == XAIE_OK);
+
+    /* Task handles complete once the channel has run them */
+    Ring = XAie_DmaBdRingCreate(&DevInst, Loc, 1U, DMA_MM2S, 4U);
+    UTEST_CHECK(Ring != NULL);
+    UTEST_CHECK(XAie_DmaTaskSubmit(Ring, Descs, 1U, &Task) == XAIE_OK);
+    set_task_queue(&DevInst, UTEST_MEMTILE_MM2S_1_STATUS, 1U);
+    UTEST_CHECK(XAie_DmaTaskPoll(&Task, &Done) == XAIE_OK && Done == 0U);
+    UTEST_CHECK(XAie_DmaTaskWaitAll(&Task, 1U, 100U) == XAIE_TIMEOUT);
+    set_task_queue(&DevInst, UTEST_MEMTILE_MM2S_1_STATUS, 0U);
+    UTEST_CHECK(XAie_DmaTaskWaitAll(&Task, 1U, 100U) == XAIE_OK);
+    UTEST_CHECK(XAie_DmaTaskPoll(&Task, &Done) == XAIE_OK && Done == 1U);
+
+    /* Rings still allocated are freed with the instance */
+    XAie_Finish(&DevInst);
+
+    return 0;
+}
 
 int main() {
+    int Failed = 0;
 
     /* Initialize aie driver. */
     XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
@@ -96,13 +479,31 @@ int main() {
 
         /* test case for run custom op */
         XAie_AddCustomTxnOp(&DevInst, Op2, &dpu_op2, sizeof(dpu_op_2));
+        XAie_RegisterCustomTxnOpHandler(&DevInst, Op2, dpu_op_2_handler,
+                NULL);
 
         /* test case for invalid op code */
         XAie_AddCustomTxnOp(&DevInst, 254, &dpu_op2, sizeof(dpu_op_2));
     }
     /* test case for serialization */
-    _XAie_TxnExportSerialized(&DevInst,0,0);
+    u8 *TxnPtr = _XAie_TxnExportSerialized(&DevInst,0,0);
+
+    /* test case for host execution of custom ops */
+    if(TxnPtr != NULL) {
+        XAie_ExecuteSerializedTransaction(&DevInst, TxnPtr,
+                ((XAie_TxnHeader *)TxnPtr)->TxnSize);
+        XAie_FreeSerializedTransaction(TxnPtr);
+    }
     _XAie_ClearTransaction(&DevInst);
     _XAie_TxnExportSerialized(&DevInst,0,0);
 
+    /* Register file backend tests */
+    Failed += test_txn_round_trip();
+    Failed += test_txn_coalescing();
+    Failed += test_shadow_cache();
+    Failed += test_dma_write_bds();
+    Failed += test_dma_bd_ring();
+    printf("UNIT TEST %s\n", (Failed == 0) ? "PASS" : "FAIL");
+
+    return (Failed == 0) ? 0 : 1;
 }
\ No newline at end of file
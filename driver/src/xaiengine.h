@@ -11,12 +11,14 @@ extern "C" {
 #include <xaiengine/xaie_clock.h>
 #include <xaiengine/xaie_core.h>
 #include <xaiengine/xaie_dma.h>
+#include <xaiengine/xaie_dma_ring.h>
 #include <xaiengine/xaie_elfloader.h>
 #include <xaiengine/xaie_events.h>
 #include <xaiengine/xaie_interrupt.h>
 #include <xaiengine/xaie_lite.h>
 #include <xaiengine/xaie_locks.h>
 #include <xaiengine/xaie_mem.h>
+#include <xaiengine/xaie_mempool.h>
 #include <xaiengine/xaie_perfcnt.h>
 #include <xaiengine/xaie_plif.h>
 #include <xaiengine/xaie_reset.h>